@@ -0,0 +1,141 @@
+#include <celero/Celero.h>
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///
+/// This is the main(int argc, char** argv) for the entire celero program.
+/// You can write your own, or use this macro to insert the standard one into the project.
+///
+CELERO_MAIN
+
+///
+/// An unsorted vector of pairs, searched linearly.  Used as the baseline.
+///
+class LinearMap
+{
+public:
+	using const_iterator = std::vector<std::pair<int, int>>::const_iterator;
+
+	void emplace(int key, int value)
+	{
+		this->data.emplace_back(key, value);
+	}
+
+	const_iterator find(int key) const
+	{
+		return std::find_if(std::begin(this->data), std::end(this->data), [key](const std::pair<int, int>& x) { return x.first == key; });
+	}
+
+	const_iterator end() const
+	{
+		return std::end(this->data);
+	}
+
+private:
+	std::vector<std::pair<int, int>> data;
+};
+
+///
+/// A sorted vector of pairs, searched with a binary search, in the style of flat_map.
+///
+class FlatMap
+{
+public:
+	using const_iterator = std::vector<std::pair<int, int>>::const_iterator;
+
+	void emplace(int key, int value)
+	{
+		const auto found = this->lowerBound(key);
+
+		if(found == std::end(this->data) || found->first != key)
+		{
+			this->data.emplace(found, key, value);
+		}
+	}
+
+	const_iterator find(int key) const
+	{
+		const auto found = this->lowerBound(key);
+		return (found != std::end(this->data) && found->first == key) ? found : std::end(this->data);
+	}
+
+	const_iterator end() const
+	{
+		return std::end(this->data);
+	}
+
+private:
+	const_iterator lowerBound(int key) const
+	{
+		return std::lower_bound(std::begin(this->data), std::end(this->data), key,
+								[](const std::pair<int, int>& x, int k) { return x.first < k; });
+	}
+
+	std::vector<std::pair<int, int>> data;
+};
+
+///
+/// \class	FindFixture
+///
+///	\brief	Fills a container of the given type with every other integer, then looks up a mix of present and missing keys.
+///
+/// The same benchmark runs for each container type through BENCHMARK_TEMPLATE_F.
+///
+/// \code
+/// celeroExperimentContainerFind -t find.csv
+/// \endcode
+///
+template <typename Container>
+class FindFixture : public celero::TestFixture
+{
+public:
+	std::vector<std::shared_ptr<celero::TestFixture::ExperimentValue>> getExperimentValues() const override
+	{
+		return celero::ProblemSpace().range("size", 16, 4096, 4).build();
+	}
+
+	void setUp(const celero::TestFixture::ExperimentValue* const experimentValue) override
+	{
+		const auto size = static_cast<int>(experimentValue->Value);
+
+		this->container = Container();
+
+		for(int i = 0; i < size; ++i)
+		{
+			this->container.emplace(i * 2, i);
+		}
+
+		this->keys.resize(256);
+		std::generate(std::begin(this->keys), std::end(this->keys), [size]() { return std::abs(celero::Random()) % (size * 2); });
+		this->next = 0;
+	}
+
+	bool lookUpNextKey()
+	{
+		const auto key = this->keys[this->next++ % this->keys.size()];
+		return this->container.find(key) != this->container.end();
+	}
+
+	Container container;
+	std::vector<int> keys;
+	size_t next{0};
+};
+
+static const int SamplesCount = 30;
+static const int IterationsCount = 10000;
+
+using LinearFindFixture = FindFixture<LinearMap>;
+
+BASELINE_F(Find, LinearMap, LinearFindFixture, SamplesCount, IterationsCount)
+{
+	celero::DoNotOptimizeAway(this->lookUpNextKey());
+}
+
+BENCHMARK_TEMPLATE_F(Find, Find, FindFixture, (FlatMap, std::map<int, int>, std::unordered_map<int, int>), SamplesCount, IterationsCount)
+{
+	celero::DoNotOptimizeAway(this->lookUpNextKey());
+}
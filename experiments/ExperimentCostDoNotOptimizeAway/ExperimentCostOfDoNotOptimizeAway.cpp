@@ -34,6 +34,13 @@ BENCHMARK(DNOA, VarImpl, SamplesCount, IterationsCount)
 	celero::DoNotOptimizeAway(x);
 }
 
+BENCHMARK(DNOA, VarClobberMemory, SamplesCount, IterationsCount)
+{
+	std::vector<int> x(1024);
+	celero::DoNotOptimizeAway(x.data());
+	celero::ClobberMemory();
+}
+
 BENCHMARK(DNOA, VarChrono, SamplesCount, IterationsCount)
 {
 	std::vector<int> x(1024);
@@ -202,3 +209,34 @@ BENCHMARK(DNOA, LambdaVolatile, SamplesCount, IterationsCount)
 #ifndef WIN32
 #pragma GCC diagnostic pop
 #endif
+
+// The cost of the barriers alone, relative to an empty benchmark body.  The inline assembly implementations emit no instructions, so
+// DoNotOptimizeAway and ClobberMemory should both measure within noise of the baseline.  ThreadID is the former implementation.
+
+BASELINE(DNOACost, Empty, SamplesCount, IterationsCount)
+{
+}
+
+BENCHMARK(DNOACost, DoNotOptimizeAway, SamplesCount, IterationsCount)
+{
+	int x = 42;
+	celero::DoNotOptimizeAway(x);
+}
+
+BENCHMARK(DNOACost, ClobberMemory, SamplesCount, IterationsCount)
+{
+	celero::ClobberMemory();
+}
+
+BENCHMARK(DNOACost, ThreadID, SamplesCount, IterationsCount)
+{
+	int x = 42;
+
+	static auto ttid = std::this_thread::get_id();
+	if(ttid == std::thread::id())
+	{
+		const auto* p = &x;
+		putchar(*reinterpret_cast<const char*>(p));
+		std::abort();
+	}
+}
@@ -55,28 +55,28 @@ public:
 		return problemSpace;
 	}
 
-	/// Before each sample, build a vector of random integers.
+	/// Before each sample, build one vector of random integers per iteration.
 	void setUp(const celero::TestFixture::ExperimentValue* const experimentValue) override
 	{
 		this->arraySize = experimentValue->Value;
-		this->array.resize(this->arraySize);
-	}
 
-	// Before each iteration
-	void onExperimentStart(const celero::TestFixture::ExperimentValue* const) override
-	{
-		for(int i = 0; i < this->arraySize; i++)
-		{
-			this->array[i] = static_cast<int64_t>(celero::Random());
-		}
+		const auto size = this->arraySize;
+		this->pool.reset(
+			[size](std::vector<int64_t>& batch, size_t) {
+				batch.resize(static_cast<size_t>(size));
+
+				for(auto& x : batch)
+				{
+					x = static_cast<int64_t>(celero::Random());
+				}
+			},
+			IterationsCount);
 	}
 
-	// After each iteration
-	void onExperimentEnd() override
+	// Before each iteration, take an unsorted vector from the pool.  Swapping is constant time, so generating the input is not measured.
+	void onExperimentStart(const celero::TestFixture::ExperimentValue* const) override
 	{
-		/// After each iteration, clear the vector of random integers.
-		this->array.clear();
-		this->array.resize(this->arraySize);
+		this->array.swap(this->pool.next());
 	}
 
 	// After each sample
@@ -84,12 +84,15 @@ public:
 	{
 	}
 
+	static const int IterationsCount = 2;
+
+	celero::InputPool<std::vector<int64_t>> pool;
 	std::vector<int64_t> array;
 	int64_t arraySize;
 };
 
 static const int SamplesCount = 2000;
-static const int IterationsCount = 2;
+static const int IterationsCount = SortFixture::IterationsCount;
 
 // For a baseline, I'll choose Bubble Sort.
 BASELINE_F(SortRandInts, BubbleSort, SortFixture, SamplesCount, IterationsCount)
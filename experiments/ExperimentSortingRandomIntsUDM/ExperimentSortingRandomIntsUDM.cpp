@@ -126,6 +126,24 @@ public:
 		}
 	};
 
+	/// The median and tail of the copies per iteration, which the moments of CopyCountUDM can't show.
+	class CopyTailUDM : public celero::UserDefinedMeasurementHistogram
+	{
+		std::string getName() const override
+		{
+			return "Copy Tail";
+		}
+	};
+
+	/// Copies per second of measured time.
+	class CopyRateUDM : public celero::UserDefinedMeasurementCounter
+	{
+		std::string getName() const override
+		{
+			return "Copy Rate";
+		}
+	};
+
 	/// Used for debugging multiple UDM's
 	class RandomUDM : public celero::UserDefinedMeasurementTemplate<size_t>
 	{
@@ -202,6 +220,8 @@ public:
 		this->array.clear();
 
 		this->copyCountUDM->addValue(CopyCountingInt::getCount());
+		this->copyTailUDM->addValue(CopyCountingInt::getCount());
+		this->copyRateUDM->addValue(static_cast<double>(CopyCountingInt::getCount()));
 		CopyCountingInt::resetCount();
 
 		this->randomUDM->addValue(static_cast<size_t>(rand()));
@@ -209,13 +229,15 @@ public:
 
 	std::vector<std::shared_ptr<celero::UserDefinedMeasurement>> getUserDefinedMeasurements() const override
 	{
-		return {this->copyCountUDM, this->randomUDM};
+		return {this->copyCountUDM, this->copyTailUDM, this->copyRateUDM, this->randomUDM};
 	}
 
 	std::vector<CopyCountingInt> array;
 	int64_t arraySize{0};
 
 	std::shared_ptr<CopyCountUDM> copyCountUDM{new CopyCountUDM};
+	std::shared_ptr<CopyTailUDM> copyTailUDM{new CopyTailUDM};
+	std::shared_ptr<CopyRateUDM> copyRateUDM{new CopyRateUDM};
 	std::shared_ptr<RandomUDM> randomUDM{new RandomUDM};
 };
 
@@ -18,6 +18,7 @@
 /// limitations under the License.
 ///
 
+#include <celero/ArchiveHistory.h>
 #include <celero/Experiment.h>
 #include <celero/ExperimentResult.h>
 #include <string>
@@ -32,11 +33,46 @@ namespace celero
 	class CELERO_EXPORT Archive
 	{
 	public:
+		///
+		/// \enum Format
+		///
+		/// The on-disk layout of a results archive file.
+		///
+		enum class Format
+		{
+			/// Human-readable comma separated values.  This is the default.
+			CSV,
+
+			/// Versioned, fixed-size records followed by a string table.  Loaded via a memory map without any text parsing.  Results are looked up
+			/// and updated in place, and saving copies unchanged records straight from the map.
+			Binary
+		};
+
 		///
 		/// Singleton
 		///
 		static Archive& Instance();
 
+		///
+		/// Converts an existing archive file into the given format.
+		///
+		/// The format of the input file is detected automatically.
+		///
+		/// \param inputFile	The name of an existing archive file (CSV or binary).
+		/// \param outputFile	The name of the file to write.
+		/// \param outputFormat	The format to write the output file in.
+		///
+		/// \return	True if the input could be read and the output was written.
+		///
+		static bool Convert(const std::string& inputFile, const std::string& outputFile, Format outputFormat);
+
+		///
+		/// Inspect the first bytes of a file to determine its archive format.
+		///
+		/// Files which do not exist or are not binary archives are reported as CSV.
+		///
+		static Format DetectFormat(const std::string& fileName);
+
 		///
 		/// Specify a file name for a results output file.
 		///
@@ -44,17 +80,61 @@ namespace celero
 		///
 		void setFileName(const std::string& x);
 
+		///
+		/// Specify the format used when saving the archive.
+		///
+		/// When an existing binary archive is opened via setFileName(), the format is switched to Format::Binary.
+		///
+		void setFormat(Format x);
+
+		///
+		/// The format used when saving the archive.
+		///
+		Format getFormat() const;
+
+		///
+		/// Keep every archived run, not only the best, worst, and current ones.
+		///
+		/// The history is stored alongside the archive in "<archive file>.history".  Call before setFileName() so the existing history is
+		/// loaded.
+		///
+		void setHistoryEnabled(bool x);
+
+		///
+		/// True if every archived run is kept in the history.
+		///
+		bool getHistoryEnabled() const;
+
+		///
+		/// An optional label (such as a commit hash or build number) recorded with each new history point.
+		///
+		void setLabel(const std::string& x);
+
+		///
+		/// The full history of archived runs.  Empty unless the history is enabled.
+		///
+		const ArchiveHistory& getHistory() const;
+
+		///
+		/// The history of a single experiment problem space, oldest first.
+		///
+		/// \param parameters	The parameter string of a multi-dimensional problem space (see ExperimentValue::getParameterString).
+		///
+		std::vector<ArchiveHistoryPoint> getHistory(const std::string& groupName, const std::string& runName, int64_t experimentValue,
+													const std::string& parameters = std::string()) const;
+
 		///
 		/// Adds or updates a result which will be saved to a results archive file.
 		///
-		/// This should re-save on every new result so that the output can be monitored externally.
+		/// The file is not written here; call save() once all results are in.
 		///
 		void add(std::shared_ptr<celero::ExperimentResult> x);
 
 		///
 		/// Saves all current results to a results archive file.
 		///
-		/// Will overwrite all existing data and refresh with new data.
+		/// Writes to a temporary file which then replaces the archive, so an interrupted save leaves the old archive intact.
+		/// Celero calls this once at the end of a run.
 		///
 		void save();
 
@@ -0,0 +1,157 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Export.h>
+#include <celero/Pimpl.h>
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace celero
+{
+	///
+	/// \struct ArchiveHistoryKey
+	///
+	/// Identifies one series in the history: a single problem space of a single experiment.
+	///
+	struct CELERO_EXPORT ArchiveHistoryKey
+	{
+		std::string GroupName;
+		std::string RunName;
+		int64_t ExperimentValue{0};
+
+		/// The parameter string of a multi-dimensional problem space, or empty.
+		std::string Parameters;
+
+		bool operator==(const ArchiveHistoryKey& other) const;
+		bool operator<(const ArchiveHistoryKey& other) const;
+	};
+
+	///
+	/// \struct ArchiveHistoryPoint
+	///
+	/// The summary statistics of one run of one experiment problem space.
+	///
+	struct CELERO_EXPORT ArchiveHistoryPoint
+	{
+		/// Milliseconds since epoch when the result was archived.
+		uint64_t Timestamp{0};
+
+		/// An optional user-supplied label, such as a commit hash or build number.
+		std::string Label;
+
+		uint64_t Samples{0};
+		double Baseline{0};
+		double UsPerCall{0};
+		double Mean{0};
+		double StandardDeviation{0};
+		int64_t Min{0};
+		int64_t Max{0};
+	};
+
+	///
+	/// \class ArchiveHistory
+	///
+	/// \author	John Farrier
+	///
+	/// Retains every archived run, rather than only the best, worst, and current ones.
+	///
+	/// Points are stored column-wise (one contiguous array per statistic) both in memory and on disk, so the file is read and written with a
+	/// single bulk copy per column and scanning a single statistic of a single series touches only that column.
+	///
+	class CELERO_EXPORT ArchiveHistory
+	{
+	public:
+		ArchiveHistory();
+		~ArchiveHistory();
+
+		ArchiveHistory(const ArchiveHistory&) = delete;
+		ArchiveHistory& operator=(const ArchiveHistory&) = delete;
+
+		///
+		/// Replaces the current contents with the contents of the given history file.
+		///
+		/// \return	False if the file does not exist or is not a compatible history file.  The history is empty in that case.
+		///
+		bool load(const std::string& fileName);
+
+		///
+		/// Writes the full history to the given file, replacing its contents.
+		///
+		/// The history is written to a temporary file which then replaces the given one, so a failed save leaves the previous file intact.
+		///
+		bool save(const std::string& fileName) const;
+
+		///
+		/// Removes all points.
+		///
+		void clear();
+
+		///
+		/// Appends a point to the series identified by the key.
+		///
+		void add(const ArchiveHistoryKey& key, const ArchiveHistoryPoint& point);
+
+		///
+		/// The total number of points across all series.
+		///
+		size_t size() const;
+
+		///
+		/// All series which have at least one point, sorted by group, run, and experiment value.
+		///
+		std::vector<ArchiveHistoryKey> getKeys() const;
+
+		///
+		/// All points of one series, in the order they were added.
+		///
+		std::vector<ArchiveHistoryPoint> get(const ArchiveHistoryKey& key) const;
+
+		///
+		/// Computes the least-squares slope of UsPerCall over the run index, as a percentage of the series mean per run.
+		///
+		/// Positive values indicate the experiment is getting slower.  Returns zero for fewer than two points.
+		///
+		static double TrendSlope(const std::vector<ArchiveHistoryPoint>& x);
+
+		///
+		/// Renders UsPerCall of the given points as a UTF-8 sparkline, one character per point.
+		///
+		static std::string Sparkline(const std::vector<ArchiveHistoryPoint>& x);
+
+		///
+		/// Prints one line per series with its sparkline, trend slope, and most recent label.
+		///
+		void printTrends(std::ostream& os) const;
+
+	private:
+		///
+		/// \brief	Pimpl Idiom
+		///
+		class Impl;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		Pimpl<Impl> pimpl;
+	};
+} // namespace celero
@@ -0,0 +1,115 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Export.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace celero
+{
+	///
+	/// \brief	Tools to measure code running with cold CPU caches.
+	///
+	/// By default every sample runs its iterations back to back, so only hot-cache performance is measured.  In cold-cache mode the caches
+	/// are emptied after setUp and, optionally, between iterations, always outside of the timed region.
+	///
+	namespace cache
+	{
+		///
+		/// How often the caches are made cold.
+		///
+		enum class Mode : int
+		{
+			/// Never (the default).
+			None,
+
+			/// Once per sample, after setUp.
+			Sample,
+
+			/// After setUp and after every iteration.  Each iteration is then timed on its own, so results are subject to timer
+			/// resolution for very short iterations.
+			Iteration
+		};
+
+		///
+		/// How the caches are made cold.
+		///
+		enum class Method : int
+		{
+			/// Stream through a buffer twice the size of the last-level cache, replacing everything in it.
+			Flush,
+
+			/// Evict only the memory a fixture reports through TestFixture::getColdCacheRegions, using clflush where the processor
+			/// supports it.  Falls back to Flush if the fixture reports nothing or clflush is unavailable.
+			Evict
+		};
+
+		///
+		/// \struct Region
+		///
+		/// A range of memory to evict from the caches.
+		///
+		struct Region
+		{
+			const void* Data{nullptr};
+			size_t Size{0};
+		};
+
+		///
+		/// Sets how often the caches are made cold.
+		///
+		CELERO_EXPORT void SetMode(Mode x);
+
+		///
+		/// Gets how often the caches are made cold.
+		///
+		CELERO_EXPORT Mode GetMode();
+
+		///
+		/// Sets how the caches are made cold.
+		///
+		CELERO_EXPORT void SetMethod(Method x);
+
+		///
+		/// Gets how the caches are made cold.
+		///
+		CELERO_EXPORT Method GetMethod();
+
+		///
+		/// The size of the largest data cache, in bytes, as reported by the operating system.  Detected once.
+		///
+		/// Falls back to 32 MB if the size cannot be determined.
+		///
+		CELERO_EXPORT int64_t GetLastLevelCacheSize();
+
+		///
+		/// Replaces the contents of every data cache by streaming through a buffer twice the size of the last-level cache.
+		///
+		CELERO_EXPORT void Flush();
+
+		///
+		/// Evicts the given memory from every cache level.
+		///
+		/// \return	False if the processor has no supported cache line flush instruction, in which case nothing is done.
+		///
+		CELERO_EXPORT bool Evict(const void* data, size_t size);
+	} // namespace cache
+} // namespace celero
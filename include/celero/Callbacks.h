@@ -35,6 +35,7 @@
 
 #include <celero/Experiment.h>
 #include <celero/Export.h>
+#include <cstdint>
 #include <functional>
 #include <memory>
 
@@ -54,10 +55,26 @@ namespace celero
 	///
 	CELERO_EXPORT void AddExperimentResultCompleteFunction(std::function<void(std::shared_ptr<celero::ExperimentResult>)> x);
 
+	///
+	/// \brief	Add a function to call when measurement of an experiment problem space begins.
+	///
+	/// This will be called once the sample and iteration sizes are known, before the first sample is taken.
+	///
+	CELERO_EXPORT void AddExperimentResultStartFunction(std::function<void(std::shared_ptr<celero::ExperimentResult>)> x);
+
+	///
+	/// \brief	Add a function to call after every recorded sample.
+	///
+	/// This is called between samples, outside of the timed region, with the measured time of the sample in microseconds.
+	///
+	CELERO_EXPORT void AddSampleCompleteFunction(std::function<void(std::shared_ptr<celero::ExperimentResult>, uint64_t)> x);
+
 	namespace impl
 	{
 		CELERO_EXPORT void ExperimentComplete(std::shared_ptr<Experiment> x);
 		CELERO_EXPORT void ExperimentResultComplete(std::shared_ptr<celero::ExperimentResult> x);
+		CELERO_EXPORT void ExperimentResultStart(std::shared_ptr<celero::ExperimentResult> x);
+		CELERO_EXPORT void SampleComplete(std::shared_ptr<celero::ExperimentResult> x, uint64_t sampleTime);
 	} // namespace impl
 } // namespace celero
 
@@ -36,9 +36,17 @@
 
 #include <celero/Benchmark.h>
 #include <celero/GenericFactory.h>
+#include <celero/InputPool.h>
+#include <celero/ProblemSpace.h>
+#include <celero/Registrar.h>
+#include <celero/Registration.h>
 #include <celero/TestFixture.h>
 #include <celero/ThreadTestFixture.h>
 #include <celero/UserDefinedMeasurementCollector.h>
+#include <celero/UserDefinedMeasurementCounter.h>
+#include <celero/UserDefinedMeasurementHistogram.h>
+#include <celero/UserDefinedMeasurementRate.h>
+#include <celero/UserDefinedMeasurementRatio.h>
 #include <celero/UserDefinedMeasurementTemplate.h>
 #include <celero/Utilities.h>
 
@@ -94,7 +102,9 @@ namespace celero
 	///
 	/// \brief	The main test executor.
 	///
-	CELERO_EXPORT void Run(int argc, char** argv);
+	/// \return	The process exit code: zero on success, or nonzero if any result was flagged as a performance regression.
+	///
+	CELERO_EXPORT int Run(int argc, char** argv);
 } // namespace celero
 
 ///
@@ -102,11 +112,10 @@ namespace celero
 ///
 ///	\brief	A macro to build the most basic main() required to run the benchmark tests.
 ///
-#define CELERO_MAIN                 \
-	int main(int argc, char** argv) \
-	{                               \
-		celero::Run(argc, argv);    \
-		return 0;                   \
+#define CELERO_MAIN                     \
+	int main(int argc, char** argv)     \
+	{                                   \
+		return celero::Run(argc, argv); \
 	}
 
 ///
@@ -121,25 +130,25 @@ namespace celero
 ///
 ///	A macro to create a class of a unique name which can be used to register and execute a benchmark test.
 ///
-#define BENCHMARK_IMPL(groupName, benchmarkName, fixtureName, samples, iterations, threads)                                   \
-	class BENCHMARK_CLASS_NAME(groupName, benchmarkName) : public fixtureName                                                 \
-	{                                                                                                                         \
-	public:                                                                                                                   \
-		BENCHMARK_CLASS_NAME(groupName, benchmarkName)() : fixtureName()                                                      \
-		{                                                                                                                     \
-		}                                                                                                                     \
-                                                                                                                              \
-	protected:                                                                                                                \
-		void UserBenchmark() override;                                                                                        \
-                                                                                                                              \
-	private:                                                                                                                  \
-		static const std::shared_ptr<::celero::Benchmark> info;                                                               \
-	};                                                                                                                        \
-                                                                                                                              \
-	const std::shared_ptr<::celero::Benchmark> BENCHMARK_CLASS_NAME(groupName, benchmarkName)::info =                         \
-		::celero::RegisterTest(#groupName, #benchmarkName, samples, iterations, threads,                                      \
-							   std::make_shared<::celero::GenericFactory<BENCHMARK_CLASS_NAME(groupName, benchmarkName)>>()); \
-                                                                                                                              \
+#define BENCHMARK_IMPL(groupName, benchmarkName, fixtureName, samples, iterations, threads)           \
+	class BENCHMARK_CLASS_NAME(groupName, benchmarkName) : public fixtureName                         \
+	{                                                                                                 \
+	public:                                                                                           \
+		BENCHMARK_CLASS_NAME(groupName, benchmarkName)() : fixtureName()                              \
+		{                                                                                             \
+		}                                                                                             \
+                                                                                                      \
+	protected:                                                                                        \
+		void UserBenchmark() override;                                                                \
+                                                                                                      \
+	private:                                                                                          \
+		static const ::celero::Registration info;                                                     \
+	};                                                                                                \
+                                                                                                      \
+	const ::celero::Registration BENCHMARK_CLASS_NAME(groupName, benchmarkName)::info(                \
+		::celero::Registration::Kind::Test, #groupName, #benchmarkName, samples, iterations, threads, \
+		&::celero::CreateGenericFactory<BENCHMARK_CLASS_NAME(groupName, benchmarkName)>);             \
+                                                                                                      \
 	void BENCHMARK_CLASS_NAME(groupName, benchmarkName)::UserBenchmark()
 
 ///
@@ -147,25 +156,25 @@ namespace celero
 ///
 ///	A macro to create a class of a unique name which can be used to register and execute a benchmark test.
 ///
-#define BENCHMARK_TEST_IMPL(groupName, benchmarkName, fixtureName, samples, iterations, threads, target)                              \
-	class BENCHMARK_CLASS_NAME(groupName, benchmarkName) : public fixtureName                                                         \
-	{                                                                                                                                 \
-	public:                                                                                                                           \
-		BENCHMARK_CLASS_NAME(groupName, benchmarkName)() : fixtureName()                                                              \
-		{                                                                                                                             \
-		}                                                                                                                             \
-                                                                                                                                      \
-	protected:                                                                                                                        \
-		void UserBenchmark() override;                                                                                                \
-                                                                                                                                      \
-	private:                                                                                                                          \
-		static const std::shared_ptr<::celero::Benchmark> info;                                                                       \
-	};                                                                                                                                \
-                                                                                                                                      \
-	const std::shared_ptr<::celero::Benchmark> BENCHMARK_CLASS_NAME(groupName, benchmarkName)::info =                                 \
-		::celero::RegisterTest(#groupName, #benchmarkName, samples, iterations, threads,                                              \
-							   std::make_shared<::celero::GenericFactory<BENCHMARK_CLASS_NAME(groupName, benchmarkName)>>(), target); \
-                                                                                                                                      \
+#define BENCHMARK_TEST_IMPL(groupName, benchmarkName, fixtureName, samples, iterations, threads, target) \
+	class BENCHMARK_CLASS_NAME(groupName, benchmarkName) : public fixtureName                            \
+	{                                                                                                    \
+	public:                                                                                              \
+		BENCHMARK_CLASS_NAME(groupName, benchmarkName)() : fixtureName()                                 \
+		{                                                                                                \
+		}                                                                                                \
+                                                                                                         \
+	protected:                                                                                           \
+		void UserBenchmark() override;                                                                   \
+                                                                                                         \
+	private:                                                                                             \
+		static const ::celero::Registration info;                                                        \
+	};                                                                                                   \
+                                                                                                         \
+	const ::celero::Registration BENCHMARK_CLASS_NAME(groupName, benchmarkName)::info(                   \
+		::celero::Registration::Kind::Test, #groupName, #benchmarkName, samples, iterations, threads,    \
+		&::celero::CreateGenericFactory<BENCHMARK_CLASS_NAME(groupName, benchmarkName)>, target);        \
+                                                                                                         \
 	void BENCHMARK_CLASS_NAME(groupName, benchmarkName)::UserBenchmark()
 
 ///
@@ -228,6 +237,52 @@ namespace celero
 #define BENCHMARK_TEST(groupName, benchmarkName, samples, iterations, target) \
 	BENCHMARK_TEST_IMPL(groupName, benchmarkName, ::celero::TestFixture, samples, iterations, 1, target)
 
+///
+/// \define CELERO_STRIP_PARENS
+///
+/// \brief	A macro to remove the parentheses around a macro argument, such as the type list of BENCHMARK_TEMPLATE_F.
+///
+#define CELERO_STRIP_PARENS(...) __VA_ARGS__
+
+///
+///	\define	BENCHMARK_TEMPLATE_IMPL
+///
+///	A macro to create a class template of a unique name, and register one benchmark test for each type in a parenthesized type list.
+///
+#define BENCHMARK_TEMPLATE_IMPL(groupName, benchmarkName, fixtureName, typeList, samples, iterations, threads)                             \
+	template <typename TypeParam>                                                                                                          \
+	class BENCHMARK_CLASS_NAME(groupName, benchmarkName) : public fixtureName<TypeParam>                                                   \
+	{                                                                                                                                      \
+	protected:                                                                                                                             \
+		void UserBenchmark() override;                                                                                                     \
+	};                                                                                                                                     \
+                                                                                                                                           \
+	static const ::celero::TemplateRegistration<BENCHMARK_CLASS_NAME(groupName, benchmarkName), CELERO_STRIP_PARENS typeList>              \
+		BENCHMARK_CLASS_NAME(groupName, benchmarkName##Registration)(#groupName, #benchmarkName, #typeList, samples, iterations, threads); \
+                                                                                                                                           \
+	template <typename TypeParam>                                                                                                          \
+	void BENCHMARK_CLASS_NAME(groupName, benchmarkName)<TypeParam>::UserBenchmark()
+
+///
+/// \define BENCHMARK_TEMPLATE_F
+///
+/// \brief	A macro to place in user code to define a UserBenchmark function once for every type in a list.
+///
+/// The fixture is a class template taking one type, the list is parenthesized, such as (std::map<int, int>, std::unordered_map<int, int>),
+/// and each type becomes an experiment named after it, such as "Find<std::map<int, int>>".  Inside the function the type is TypeParam, and
+/// fixture members must be accessed through this->.
+///
+#define BENCHMARK_TEMPLATE_F(groupName, benchmarkName, fixtureName, typeList, samples, iterations) \
+	BENCHMARK_TEMPLATE_IMPL(groupName, benchmarkName, fixtureName, typeList, samples, iterations, 1)
+
+///
+/// \define BENCHMARK_TEMPLATE_T
+///
+/// \brief	A macro to place in user code to define a UserBenchmark function once for every type in a list, using a threaded test fixture.
+///
+#define BENCHMARK_TEMPLATE_T(groupName, benchmarkName, fixtureName, typeList, samples, iterations, threads) \
+	BENCHMARK_TEMPLATE_IMPL(groupName, benchmarkName, fixtureName, typeList, samples, iterations, threads)
+
 ///
 /// \define	BASELINE_CLASS_NAME
 ///
@@ -240,29 +295,29 @@ namespace celero
 ///
 ///	A macro to create a class of a unique name which can be used to register and execute a baseline benchmark test.
 ///
-#define BASELINE_IMPL(groupName, baselineName, fixtureName, samples, iterations, threads, useconds)                             \
-	class BASELINE_CLASS_NAME(groupName, baselineName) : public fixtureName                                                     \
-	{                                                                                                                           \
-	public:                                                                                                                     \
-		BASELINE_CLASS_NAME(groupName, baselineName)() : fixtureName()                                                          \
-		{                                                                                                                       \
-		}                                                                                                                       \
-                                                                                                                                \
-	protected:                                                                                                                  \
-		void UserBenchmark() override;                                                                                          \
-		uint64_t HardCodedMeasurement() const override                                                                          \
-		{                                                                                                                       \
-			return uint64_t(useconds);                                                                                          \
-		}                                                                                                                       \
-                                                                                                                                \
-	private:                                                                                                                    \
-		static const std::shared_ptr<::celero::Benchmark> info;                                                                 \
-	};                                                                                                                          \
-                                                                                                                                \
-	const std::shared_ptr<::celero::Benchmark> BASELINE_CLASS_NAME(groupName, baselineName)::info =                             \
-		::celero::RegisterBaseline(#groupName, #baselineName, samples, iterations, threads,                                     \
-								   std::make_shared<::celero::GenericFactory<BASELINE_CLASS_NAME(groupName, baselineName)>>()); \
-                                                                                                                                \
+#define BASELINE_IMPL(groupName, baselineName, fixtureName, samples, iterations, threads, useconds)      \
+	class BASELINE_CLASS_NAME(groupName, baselineName) : public fixtureName                              \
+	{                                                                                                    \
+	public:                                                                                              \
+		BASELINE_CLASS_NAME(groupName, baselineName)() : fixtureName()                                   \
+		{                                                                                                \
+		}                                                                                                \
+                                                                                                         \
+	protected:                                                                                           \
+		void UserBenchmark() override;                                                                   \
+		uint64_t HardCodedMeasurement() const override                                                   \
+		{                                                                                                \
+			return uint64_t(useconds);                                                                   \
+		}                                                                                                \
+                                                                                                         \
+	private:                                                                                             \
+		static const ::celero::Registration info;                                                        \
+	};                                                                                                   \
+                                                                                                         \
+	const ::celero::Registration BASELINE_CLASS_NAME(groupName, baselineName)::info(                     \
+		::celero::Registration::Kind::Baseline, #groupName, #baselineName, samples, iterations, threads, \
+		&::celero::CreateGenericFactory<BASELINE_CLASS_NAME(groupName, baselineName)>);                  \
+                                                                                                         \
 	void BASELINE_CLASS_NAME(groupName, baselineName)::UserBenchmark()
 
 ///
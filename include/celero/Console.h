@@ -58,6 +58,14 @@ namespace celero
 		/// Set the color of std::out on the console.
 		///
 		CELERO_EXPORT void SetConsoleColor(const celero::console::ConsoleColor x);
+
+		///
+		/// The escape sequence which sets the given color on an ANSI terminal.
+		///
+		/// This allows colors to be embedded in text which is written later.  Returns an empty string on Windows, where colors can only be
+		/// set through SetConsoleColor().
+		///
+		CELERO_EXPORT const char* GetConsoleColorCode(const celero::console::ConsoleColor x);
 	} // namespace console
 } // namespace celero
 
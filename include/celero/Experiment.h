@@ -150,6 +150,30 @@ namespace celero
 		///
 		std::shared_ptr<celero::Factory> getFactory() const;
 
+		///
+		/// Overrides the fixture lifetime requested by the test fixture.
+		///
+		void setFixtureLifetime(TestFixture::FixtureLifetime x);
+
+		///
+		/// Gets how long each test fixture instance is kept: the value set on this experiment, else the one requested by its test fixture,
+		/// else the default.  Never returns FixtureLifetime::Default.
+		///
+		TestFixture::FixtureLifetime getFixtureLifetime() const;
+
+		///
+		/// Sets the fixture lifetime used when neither the experiment nor its test fixture chooses one.
+		///
+		static void SetDefaultFixtureLifetime(TestFixture::FixtureLifetime x);
+
+		///
+		/// Gets the fixture lifetime used when neither the experiment nor its test fixture chooses one.
+		///
+		static TestFixture::FixtureLifetime GetDefaultFixtureLifetime();
+
+		///
+		/// A value without iterations of its own is run with the iterations of this experiment.  The value itself is not changed, as it may
+		/// be shared with other experiments.
 		///
 		/// \param x	Can be interpreted in any way be the test fixture (i.e. index into an array, etc.)
 		/// \param scale	Used to format unit results.
@@ -171,6 +195,11 @@ namespace celero
 		///
 		std::shared_ptr<celero::ExperimentResult> getResultByValue(int64_t x);
 
+		///
+		/// Get the ExperimentResult for the given point in the problem space, matching its value and all of its parameters.
+		///
+		std::shared_ptr<celero::ExperimentResult> getResultByValue(const celero::TestFixture::ExperimentValue& x);
+
 	private:
 		///
 		/// Hide the default constructor
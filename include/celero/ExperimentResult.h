@@ -48,7 +48,7 @@ namespace celero
 		Experiment* getExperiment() const;
 
 		///
-		///
+		/// Also sets the iterations of this result to those of the value.
 		///
 		void setProblemSpaceValue(std::shared_ptr<celero::TestFixture::ExperimentValue> x, double scale = 1.0);
 
@@ -62,11 +62,21 @@ namespace celero
 		///
 		int64_t getProblemSpaceValue() const;
 
+		///
+		/// The named parameters of a multi-dimensional problem space as "name=value;name=value", or an empty string.
+		///
+		std::string getProblemSpaceParameters() const;
+
 		///
 		///
 		///
 		double getProblemSpaceValueScale() const;
 
+		///
+		/// Sets the iterations of this result without changing its problem space value, which may be shared with other experiments.
+		///
+		void setProblemSpaceIterations(uint64_t x);
+
 		///
 		///
 		///
@@ -92,6 +102,21 @@ namespace celero
 		///
 		void addMemorySample(const int64_t x);
 
+		///
+		/// Adds an unrecorded warm-up sample taken before the measured samples.
+		///
+		void addWarmupSample(const uint64_t x);
+
+		///
+		/// Statistics of the warm-up sample times, kept apart from the measured samples.
+		///
+		const Statistics<int64_t>& getWarmupStatistics() const;
+
+		///
+		/// Returns the first (coldest) warm-up sample, or zero if there was no warm-up.
+		///
+		uint64_t getWarmupFirstRunTime() const;
+
 		///
 		/// Returns the best run time sample observed.
 		///
@@ -123,6 +148,36 @@ namespace celero
 		///
 		double getUnitsPerSecond() const;
 
+		///
+		/// Sets the number of bytes one iteration processes, as reported by the fixture.
+		///
+		void setBytesPerIteration(int64_t x);
+
+		///
+		/// The number of bytes one iteration processes, or zero if the fixture does not report it.
+		///
+		int64_t getBytesPerIteration() const;
+
+		///
+		/// Sets the number of items one iteration processes, as reported by the fixture.
+		///
+		void setItemsPerIteration(int64_t x);
+
+		///
+		/// The number of items one iteration processes, or zero if the fixture does not report it.
+		///
+		int64_t getItemsPerIteration() const;
+
+		///
+		/// The bandwidth in bytes per second, based on the best sample.  Zero if the fixture does not report bytes processed.
+		///
+		double getBytesPerSecond() const;
+
+		///
+		/// The throughput in items per second, based on the best sample.  Zero if the fixture does not report items processed.
+		///
+		double getItemsPerSecond() const;
+
 		///
 		/// Calculate this experiments baseline value.
 		///
@@ -151,6 +206,21 @@ namespace celero
 		///
 		bool getFailure() const;
 
+		///
+		/// Marks this result as a performance regression against the archived mean us/Iteration given.
+		///
+		void setRegressionReference(double x);
+
+		///
+		/// The archived mean us/Iteration this result regressed against, or zero if it is not a regression.
+		///
+		double getRegressionReference() const;
+
+		///
+		/// Gets a flag indicating if this result was flagged as a performance regression.
+		///
+		bool getRegression() const;
+
 		///
 		///
 		///
@@ -19,8 +19,12 @@
 ///
 
 #include <celero/Export.h>
+#include <celero/Pimpl.h>
 #include <celero/TestFixture.h>
+
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace celero
 {
@@ -31,27 +35,82 @@ namespace celero
 	///
 	/// Pure Virtual Base class for benchmarks.
 	///
+	/// The factory also caches the metadata Celero needs before running a fixture (its problem space and user-defined measurement names).
+	/// The metadata is read from a single fixture, created the first time any of it is requested and released immediately afterwards, so
+	/// fixtures with expensive constructors are otherwise only constructed when they are actually run.
+	///
 	class CELERO_EXPORT Factory
 	{
 	public:
 		///
 		/// \brief	Default Constructor
 		///
-		Factory()
-		{
-		}
+		Factory();
 
 		///
 		/// \brief	Virtual Destructor
 		///
-		virtual ~Factory()
-		{
-		}
+		virtual ~Factory();
 
 		///
 		/// \brief	Pure virtual function.
 		///
 		virtual std::shared_ptr<TestFixture> Create() = 0;
+
+		///
+		/// False if no fixture could be created to read the metadata from.
+		///
+		bool getIsValid();
+
+		///
+		/// The problem space values of the fixture.  The same instances are returned on every call.
+		///
+		const std::vector<std::shared_ptr<TestFixture::ExperimentValue>>& getExperimentValues();
+
+		///
+		/// The result scale of the fixture's problem space values.
+		///
+		double getExperimentValueResultScale();
+
+		///
+		/// The fixture lifetime the fixture asks for.
+		///
+		TestFixture::FixtureLifetime getFixtureLifetime();
+
+		///
+		/// True if the fixture reports bytes processed for any of its problem space values.
+		///
+		bool getReportsBytes();
+
+		///
+		/// True if the fixture reports items processed for any of its problem space values.
+		///
+		bool getReportsItems();
+
+		///
+		/// The names of the fixture's user-defined measurements.
+		///
+		const std::vector<std::string>& getUserDefinedMeasurementNames();
+
+		///
+		/// The result columns of the fixture's user-defined measurements, as "<name> <aggregate>".
+		///
+		const std::vector<std::string>& getUserDefinedMeasurementFields();
+
+	private:
+		///
+		/// Reads all metadata from a temporary fixture, once.
+		///
+		void cacheMetadata();
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		class Impl;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		Pimpl<Impl> pimpl;
 	};
 }
-
@@ -0,0 +1,147 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Benchmark.h>
+#include <celero/Experiment.h>
+#include <celero/Export.h>
+#include <celero/Pimpl.h>
+#include <celero/TestFixture.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace celero
+{
+	///
+	/// \class Filter
+	///
+	/// \author	John Farrier
+	///
+	/// Selects which experiments and problem spaces are run.
+	///
+	/// Patterns are matched against "Group.Experiment/ProblemSpace".  The part before the last '/' is matched against "Group.Experiment"
+	/// and the optional part after it against the problem space value ("Null" when the experiment has no problem space).  Patterns are
+	/// globs, where '*' matches any run of characters and '?' any single character, unless prefixed with "regex:", in which case both parts
+	/// are ECMAScript regular expressions which must match the whole name.
+	///
+	/// Experiments are selected by name alone, before any fixture is created.  Problem spaces are selected once the experiment's values
+	/// are known.  A baseline is always kept when any experiment in its group is selected.
+	///
+	class CELERO_EXPORT Filter
+	{
+	public:
+		///
+		/// Singleton
+		///
+		static Filter& Instance();
+
+		///
+		/// Run only what matches at least one included pattern.
+		///
+		/// \return	False if the pattern is not a valid regular expression.
+		///
+		bool addInclude(const std::string& x);
+
+		///
+		/// Skip whatever matches any excluded pattern.
+		///
+		/// \return	False if the pattern is not a valid regular expression.
+		///
+		bool addExclude(const std::string& x);
+
+		///
+		/// Remove all patterns, so that everything is selected.
+		///
+		void clear();
+
+		///
+		/// True if any pattern has been added.
+		///
+		bool isActive() const;
+
+		///
+		/// True if the experiment may have selected problem spaces.  Does not consider the baseline rule.
+		///
+		bool matches(const std::string& group, const std::string& experiment) const;
+
+		///
+		/// True if the problem space of the experiment is selected.
+		///
+		bool matches(const std::string& group, const std::string& experiment, int64_t problemSpaceValue) const;
+
+		///
+		/// True if the problem space of the experiment is selected.  A multi-dimensional problem space is matched by its parameter string,
+		/// such as "size=64;threads=4".
+		///
+		bool matches(const std::string& group, const std::string& experiment, const TestFixture::ExperimentValue& problemSpace) const;
+
+		///
+		/// True if the experiment should be run, including a baseline whose group has any selected experiment.
+		///
+		bool matches(std::shared_ptr<Experiment> x) const;
+
+		///
+		/// True if the problem space should be run, including problem spaces of a baseline needed by a selected experiment.
+		///
+		bool matches(std::shared_ptr<Experiment> x, int64_t problemSpaceValue) const;
+
+		///
+		/// True if the problem space should be run, including problem spaces of a baseline needed by a selected experiment.
+		///
+		bool matches(std::shared_ptr<Experiment> x, const TestFixture::ExperimentValue& problemSpace) const;
+
+		///
+		/// True if anything in the benchmark group should be run.
+		///
+		bool matches(std::shared_ptr<Benchmark> x) const;
+
+	private:
+		///
+		/// Default Constructor
+		///
+		Filter();
+
+		///
+		/// Non-copyable.
+		///
+		Filter(Filter&) = delete;
+
+		///
+		/// Default Destructor
+		///
+		~Filter();
+
+		///
+		/// Non-assignable.
+		///
+		Filter& operator=(const Filter&) = delete;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		class Impl;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		Pimpl<Impl> pimpl;
+	};
+} // namespace celero
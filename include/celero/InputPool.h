@@ -0,0 +1,250 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Cache.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <vector>
+
+namespace celero
+{
+	///
+	/// \class InputPool
+	///
+	/// \author	John Farrier
+	///
+	/// Pre-generated inputs for benchmarks which consume or destroy their input, such as in-place sorts.
+	///
+	/// Copying or regenerating the input inside the timed loop adds that work to every measurement.  An InputPool instead generates a number
+	/// of batches up front, hands out a fresh one per iteration through next(), and regenerates the used batches through refill() or
+	/// refillInBackground() from setUp or tearDown, outside of the timed region.
+	///
+	/// \code
+	/// void setUp(const celero::TestFixture::ExperimentValue* const x) override
+	/// {
+	///		this->pool.reset([x](std::vector<int>& batch, size_t) { batch = MakeRandomInts(x->Value); }, 16);
+	/// }
+	///
+	/// void onExperimentStart(const celero::TestFixture::ExperimentValue* const) override
+	/// {
+	///		this->input.swap(this->pool.next());
+	/// }
+	/// \endcode
+	///
+	/// The pool hands batches out in order and wraps around after size() calls to next(), so a destructive benchmark needs at least as many
+	/// batches as it runs iterations per sample.
+	///
+	template <typename T>
+	class InputPool
+	{
+	public:
+		///
+		/// Fills one batch.  The index identifies the batch within the pool.
+		///
+		/// The generator may run on a background thread (see refillInBackground), but is never run concurrently with itself.
+		///
+		using Generator = std::function<void(T& batch, size_t index)>;
+
+		///
+		/// Where the batches of a pool should reside when sized with BatchesFor.
+		///
+		enum class Residency : int
+		{
+			/// All batches together fit in half of the last-level cache, so cycling through them stays in cache.
+			InCache,
+
+			/// All batches together exceed twice the last-level cache, so each batch has been evicted by the time it is used again.
+			OutOfCache
+		};
+
+		InputPool() = default;
+
+		InputPool(const InputPool&) = delete;
+		InputPool& operator=(const InputPool&) = delete;
+
+		///
+		/// Waits for any background refill to finish.  An exception thrown by the generator during that refill is discarded, since a
+		/// destructor cannot propagate it.
+		///
+		~InputPool()
+		{
+			if(this->worker.valid() == true)
+			{
+				this->worker.wait();
+			}
+		}
+
+		///
+		/// The number of batches to use so that a pool of batches of the given size has the requested cache residency.
+		///
+		/// \param batchBytes	The approximate size of one batch, in bytes.
+		/// \param residency	Where the batches should reside.
+		/// \param minimum		The fewest batches to return, such as the number of iterations per sample.
+		///
+		static size_t BatchesFor(size_t batchBytes, Residency residency, size_t minimum = 1)
+		{
+			const auto llc = static_cast<size_t>(celero::cache::GetLastLevelCacheSize());
+			batchBytes = std::max(batchBytes, size_t(1));
+
+			size_t batches = 1;
+
+			if(residency == Residency::InCache)
+			{
+				batches = (llc / 2) / batchBytes;
+			}
+			else
+			{
+				batches = (llc * 2) / batchBytes + 1;
+			}
+
+			return std::max({batches, minimum, size_t(1)});
+		}
+
+		///
+		/// Replaces the generator and generates the given number of batches immediately.
+		///
+		void reset(Generator g, size_t batches)
+		{
+			this->wait();
+			this->pending = false;
+
+			this->generator = std::move(g);
+			this->front.clear();
+			this->front.resize(std::max(batches, size_t(1)));
+			this->back.clear();
+
+			for(size_t i = 0; i < this->front.size(); ++i)
+			{
+				this->generator(this->front[i], i);
+			}
+
+			this->cursor = 0;
+			this->used = 0;
+		}
+
+		///
+		/// The next unused batch.  Only advances an index, so it is safe to call inside the timed region.
+		///
+		/// The caller may modify, consume, or swap out the batch; it is regenerated by the next refill.  The pool must have been reset first.
+		///
+		T& next()
+		{
+			assert(this->front.empty() == false);
+
+			auto& batch = this->front[this->cursor];
+
+			if(++this->cursor == this->front.size())
+			{
+				this->cursor = 0;
+			}
+
+			++this->used;
+			return batch;
+		}
+
+		///
+		/// The number of batches in the pool.
+		///
+		size_t size() const
+		{
+			return this->front.size();
+		}
+
+		///
+		/// The number of calls to next() since the pool was last reset or refilled.  Values above size() mean batches were reused.
+		///
+		size_t getUsed() const
+		{
+			return this->used;
+		}
+
+		///
+		/// Makes every batch fresh again.
+		///
+		/// If a background refill is pending, waits for it and swaps in its batches.  Otherwise regenerates only the batches handed out since
+		/// the last refill.  Call from setUp or tearDown, never from the timed region.
+		///
+		void refill()
+		{
+			if(this->pending == true)
+			{
+				this->wait();
+				this->pending = false;
+				std::swap(this->front, this->back);
+			}
+			else
+			{
+				const auto count = std::min(this->used, this->front.size());
+
+				for(size_t i = 0; i < count; ++i)
+				{
+					this->generator(this->front[i], i);
+				}
+			}
+
+			this->cursor = 0;
+			this->used = 0;
+		}
+
+		///
+		/// Starts generating a complete set of fresh batches on a background thread.  The next call to refill() swaps them in.
+		///
+		/// Call from tearDown so that generation overlaps the time between samples.  Does nothing if a background refill is already pending.
+		///
+		void refillInBackground()
+		{
+			if(this->pending == true || this->front.empty() == true)
+			{
+				return;
+			}
+
+			this->back.resize(this->front.size());
+			this->pending = true;
+
+			this->worker = std::async(std::launch::async, [this]() {
+				for(size_t i = 0; i < this->back.size(); ++i)
+				{
+					this->generator(this->back[i], i);
+				}
+			});
+		}
+
+	private:
+		void wait()
+		{
+			if(this->worker.valid() == true)
+			{
+				this->worker.get();
+			}
+		}
+
+		Generator generator;
+		std::vector<T> front;
+		std::vector<T> back;
+		std::future<void> worker;
+		size_t cursor{0};
+		size_t used{0};
+		bool pending{false};
+	};
+} // namespace celero
@@ -0,0 +1,113 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/ExperimentResult.h>
+#include <celero/Export.h>
+#include <celero/Pimpl.h>
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+namespace celero
+{
+	///
+	/// \class JSON
+	///
+	/// \author	John Farrier
+	///
+	/// Writes all results, along with a description of the environment they were measured in, as a single JSON document.
+	///
+	/// The document is an object with an "environment" object and a "results" array holding one object per experiment problem space.
+	///
+	class CELERO_EXPORT JSON
+	{
+	public:
+		///
+		/// Singleton
+		///
+		static JSON& Instance();
+
+		///
+		/// Writes a result as a single-line JSON object with every statistic, user-defined measurement aggregate, and problem space value.
+		///
+		static void Serialize(std::ostream& os, std::shared_ptr<celero::ExperimentResult> x);
+
+		///
+		/// Writes a single-line JSON object describing the host, compiler, build, and timer the results were measured with.
+		///
+		static void SerializeEnvironment(std::ostream& os);
+
+		///
+		/// Writes a string as a quoted, escaped JSON string.
+		///
+		static void SerializeString(std::ostream& os, const std::string& x);
+
+		///
+		/// Specify a file name for a results output file.
+		///
+		/// \param x	The name of the output file in which to store Celero's results.
+		///
+		void setFileName(const std::string& x);
+
+		///
+		/// Add a new result to the JSON document.
+		///
+		/// The result is serialized once, here.  It is written out by the next call to save().
+		///
+		void add(std::shared_ptr<celero::ExperimentResult> x);
+
+		///
+		/// Save the JSON document to the given file name, replacing its contents.
+		///
+		void save();
+
+	private:
+		///
+		/// Default Constructor
+		///
+		JSON();
+
+		///
+		/// Non-copyable.
+		///
+		JSON(JSON&) = delete;
+
+		///
+		/// Default Destructor
+		///
+		~JSON();
+
+		///
+		/// Non-assignable.
+		///
+		JSON& operator=(const JSON&) = delete;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		class Impl;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		Pimpl<Impl> pimpl;
+	};
+} // namespace celero
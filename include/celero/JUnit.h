@@ -48,13 +48,16 @@ namespace celero
 		///
 		/// Add a new result to the JUnit output XML.
 		///
-		/// This should re-save on every new result so that the output can be monitored externally.
+		/// The result is rendered to its testcase element once, here.  It is written out by the next call to save().
 		///
 		void add(std::shared_ptr<celero::ExperimentResult> x);
 
 		///
 		/// Save the JUnit (XUnit) formatted file to the given file name.
 		///
+		/// The document is written to a temporary file which then replaces the output file, so the output is never left truncated.
+		/// Does nothing if no results were added since the last save.  Celero calls this once at the end of a run.
+		///
 		void save();
 
 	private:
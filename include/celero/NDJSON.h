@@ -0,0 +1,97 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/ExperimentResult.h>
+#include <celero/Export.h>
+#include <celero/Pimpl.h>
+
+#include <memory>
+#include <string>
+
+namespace celero
+{
+	///
+	/// \class NDJSON
+	///
+	/// \author	John Farrier
+	///
+	/// Streams results as newline-delimited JSON: one self-contained JSON object per line, written and flushed as each result completes.
+	///
+	/// Each line holds the same result object as the JSON document, with the environment embedded as an "environment" member so
+	/// lines can be ingested independently.
+	///
+	class CELERO_EXPORT NDJSON
+	{
+	public:
+		///
+		/// Singleton
+		///
+		static NDJSON& Instance();
+
+		///
+		/// Specify a file name for the output stream.  The file is truncated.
+		///
+		/// \param x	The name of the output file, or "-" for standard output.  While writing to standard output, everything else written to
+		///				std::cout (the banner, announcements, and the console table) is sent to standard error instead, until closeFile().
+		///
+		void setFileName(const std::string& x);
+
+		///
+		/// Write a result as a single line and flush it.
+		///
+		void add(std::shared_ptr<celero::ExperimentResult> x);
+
+		///
+		/// Close the output file.  Output of std::cout goes back to standard output.
+		///
+		void closeFile();
+
+	private:
+		///
+		/// Default Constructor
+		///
+		NDJSON();
+
+		///
+		/// Non-copyable.
+		///
+		NDJSON(NDJSON&) = delete;
+
+		///
+		/// Default Destructor
+		///
+		~NDJSON();
+
+		///
+		/// Non-assignable.
+		///
+		NDJSON& operator=(const NDJSON&) = delete;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		class Impl;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		Pimpl<Impl> pimpl;
+	};
+} // namespace celero
@@ -18,9 +18,11 @@
 /// limitations under the License.
 ///
 
+#include <celero/Console.h>
 #include <celero/Experiment.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace celero
 {
@@ -29,9 +31,24 @@ namespace celero
 	///
 	/// \author	John farrier
 	///
+	/// Each table row is formatted into a reusable buffer as the experiment runs and written to the console with a single write once the
+	/// result is complete, so nothing is printed while samples are being measured.
+	///
 	class Printer
 	{
 	public:
+		///
+		/// \enum Mode
+		///
+		enum class Mode
+		{
+			/// Print one table row per result.  This is the default.
+			Table,
+
+			/// Print only a single, continuously updated progress bar.
+			Progress
+		};
+
 		///
 		/// Singleton implementation.
 		static Printer& get()
@@ -45,6 +62,26 @@ namespace celero
 		///
 		void initialize(std::vector<std::string> userDefinedColumns);
 
+		///
+		/// Select between the full results table and a compact progress bar.
+		///
+		void setMode(Mode x);
+
+		///
+		/// Show the Bytes/sec and Items/sec columns.  Call before TableBanner.
+		///
+		void setThroughputColumns(bool bytes, bool items);
+
+		///
+		/// Scale bytes per second by powers of 1024 (KiB/s, MiB/s, ...) rather than powers of 1000 (kB/s, MB/s, ...).
+		///
+		void setBinaryUnits(bool x);
+
+		///
+		/// The number of experiments (including baselines) which will be run, used to scale the progress bar.
+		///
+		void setProgressTotal(size_t x);
+
 		void Console(const std::string& x);
 		void TableBanner(const size_t groupNameLength = 15);
 		void TableRowExperimentHeader(Experiment* x);
@@ -53,11 +90,45 @@ namespace celero
 		void TableRowHeader(std::shared_ptr<celero::ExperimentResult> x);
 		void TableResult(std::shared_ptr<celero::ExperimentResult> x);
 
+		///
+		/// Advance the progress bar by one experiment.
+		///
+		void ExperimentComplete(std::shared_ptr<celero::Experiment> x);
+
+		///
+		/// Finish the progress bar line.  Does nothing when printing the table.
+		///
+		void ProgressComplete();
+
 	private:
 		Printer() = default;
 
+		///
+		/// Switch the console color at this point in the current row.
+		///
+		void color(celero::console::ConsoleColor x);
+
+		///
+		/// Write the buffered text to the console and clear the buffer.
+		///
+		void write();
+
+		void progressBar();
+
 		std::vector<std::string> userDefinedColumns;
 		std::vector<size_t> columnWidths;
+
+		/// The row being built.  Its capacity is reused from row to row.
+		std::string buffer;
+
+		Mode mode{Mode::Table};
+		bool bytesColumn{false};
+		bool itemsColumn{false};
+		bool binaryUnits{false};
+		size_t progressTotal{0};
+		size_t progressExperiments{0};
+		size_t progressResults{0};
+		size_t progressFailures{0};
+		size_t progressRegressions{0};
 	};
 } // namespace celero
-
@@ -0,0 +1,93 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Export.h>
+#include <celero/Pimpl.h>
+#include <celero/TestFixture.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace celero
+{
+	///
+	/// \class ProblemSpace
+	///
+	/// \author	John Farrier
+	///
+	/// Builds a multi-dimensional problem space as the cartesian product of named axes, for use in TestFixture::getExperimentValues.
+	///
+	/// \code
+	/// std::vector<std::shared_ptr<celero::TestFixture::ExperimentValue>> getExperimentValues() const override
+	/// {
+	///		return celero::ProblemSpace().range("size", 64, 4096).axis("threads", {1, 2, 4}).build();
+	/// }
+	/// \endcode
+	///
+	/// Each resulting ExperimentValue carries every axis in ExperimentValue::Parameters.  Its Value is that of the first axis, so code which
+	/// only understands one dimension keeps working.
+	///
+	class CELERO_EXPORT ProblemSpace
+	{
+	public:
+		ProblemSpace();
+		~ProblemSpace();
+
+		///
+		/// Adds an axis with the given values.  Adding an axis with an existing name replaces its values.
+		///
+		ProblemSpace& axis(const std::string& name, const std::vector<int64_t>& values);
+
+		///
+		/// Adds an axis of first, first * multiplier, first * multiplier^2, ... up to and including last.
+		///
+		/// A multiplier of one or less steps by one instead.
+		///
+		ProblemSpace& range(const std::string& name, int64_t first, int64_t last, int64_t multiplier = 2);
+
+		///
+		/// Sets the number of iterations of every problem space value.  Zero (the default) uses the experiment's iterations.
+		///
+		ProblemSpace& iterations(int64_t x);
+
+		///
+		/// The number of problem space values build() will return: the product of the sizes of all axes.
+		///
+		size_t size() const;
+
+		///
+		/// The cartesian product of all axes.  The last axis varies fastest.  Empty if there are no axes or any axis is empty.
+		///
+		std::vector<std::shared_ptr<TestFixture::ExperimentValue>> build() const;
+
+	private:
+		///
+		/// \brief	Pimpl Idiom
+		///
+		class Impl;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		Pimpl<Impl> pimpl;
+	};
+} // namespace celero
@@ -0,0 +1,121 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Experiment.h>
+#include <celero/ExperimentResult.h>
+#include <celero/Export.h>
+#include <celero/Pimpl.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace celero
+{
+	///
+	/// \class ProgressStream
+	///
+	/// \author	John Farrier
+	///
+	/// Emits live progress events as newline-delimited JSON so an external dashboard or orchestrator can follow a run as it happens.
+	///
+	/// Every event is a single line, written with a single write call, with an "event" member of "resultStart", "sample", "resultComplete",
+	/// "failure", or "experimentComplete".  If the reader goes away, the stream is closed and the run continues.
+	///
+	class CELERO_EXPORT ProgressStream
+	{
+	public:
+		///
+		/// Singleton
+		///
+		static ProgressStream& Instance();
+
+		///
+		/// Open the event stream.
+		///
+		/// \param x	"fd:N" to write to an already open file descriptor (such as a pipe inherited from the parent process),
+		///				"unix:PATH" to connect to a Unix domain stream socket, or the name of a file or FIFO to write to.
+		///
+		/// \return	True if the stream was opened.
+		///
+		bool open(const std::string& x);
+
+		///
+		/// True if events are being written.
+		///
+		bool isOpen() const;
+
+		///
+		/// Close the event stream.  File descriptors given with "fd:N" are left open.
+		///
+		void close();
+
+		///
+		/// Emit a "resultStart" event for an experiment problem space about to be measured.
+		///
+		void resultStart(std::shared_ptr<celero::ExperimentResult> x);
+
+		///
+		/// Emit a "sample" event with the measured time of one sample in microseconds.
+		///
+		void sampleComplete(std::shared_ptr<celero::ExperimentResult> x, uint64_t sampleTime);
+
+		///
+		/// Emit a "resultComplete" event, or a "failure" event if the result failed.
+		///
+		void resultComplete(std::shared_ptr<celero::ExperimentResult> x);
+
+		///
+		/// Emit an "experimentComplete" event.
+		///
+		void experimentComplete(std::shared_ptr<celero::Experiment> x);
+
+	private:
+		///
+		/// Default Constructor
+		///
+		ProgressStream();
+
+		///
+		/// Non-copyable.
+		///
+		ProgressStream(ProgressStream&) = delete;
+
+		///
+		/// Default Destructor
+		///
+		~ProgressStream();
+
+		///
+		/// Non-assignable.
+		///
+		ProgressStream& operator=(const ProgressStream&) = delete;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		class Impl;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		Pimpl<Impl> pimpl;
+	};
+} // namespace celero
@@ -0,0 +1,217 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Benchmark.h>
+#include <celero/Export.h>
+#include <celero/ProblemSpace.h>
+#include <celero/TestFixture.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace celero
+{
+	///
+	/// \class State
+	///
+	/// \author	John Farrier
+	///
+	/// What a benchmark registered through celero::Register sees of its fixture: the current problem space value and the timing controls.
+	///
+	class CELERO_EXPORT State
+	{
+	public:
+		explicit State(TestFixture& fixture);
+
+		State(const State&) = delete;
+		State& operator=(const State&) = delete;
+
+		///
+		/// The problem space value of the current sample, or nullptr before the first sample.
+		///
+		const TestFixture::ExperimentValue* getExperimentValue() const;
+
+		///
+		/// The Value of the current problem space value, or zero if there is none.
+		///
+		int64_t getValue() const;
+
+		///
+		/// The value of the named axis of the current problem space value, or the given default if there is no such axis.
+		///
+		int64_t getParameter(const std::string& name, int64_t defaultValue = 0) const;
+
+		///
+		/// See TestFixture::pauseTiming().
+		///
+		void pauseTiming();
+
+		///
+		/// See TestFixture::resumeTiming().
+		///
+		void resumeTiming();
+
+		///
+		/// See TestFixture::setIterationTime().
+		///
+		void setIterationTime(uint64_t nanoseconds);
+
+		///
+		/// Internal to Celero
+		///
+		void setExperimentValue(const TestFixture::ExperimentValue* x);
+
+	private:
+		TestFixture& fixture;
+		const TestFixture::ExperimentValue* experimentValue{nullptr};
+	};
+
+	namespace impl
+	{
+		struct RegistrarDefinition;
+	} // namespace impl
+
+	///
+	/// \class Registrar
+	///
+	/// \author	John Farrier
+	///
+	/// Registers a benchmark or baseline at runtime from lambdas, for benchmarks which cannot be written down as a BENCHMARK macro, such as
+	/// those generated in a loop from a configuration file or discovered in plugins.  Created by celero::Register().
+	///
+	/// \code
+	/// for(const auto& codec : codecs)
+	/// {
+	///		celero::Register("Codec", codec.name)
+	///			.samples(10)
+	///			.iterations(100)
+	///			.problemSpace(celero::ProblemSpace().range("block", 1024, 65536))
+	///			.bytesPerIteration([](const celero::TestFixture::ExperimentValue* x) { return x->getParameter("block"); })
+	///			.run([codec](celero::State& state) { codec.encode(state.getParameter("block")); });
+	/// }
+	/// \endcode
+	///
+	/// As with the macros, every group needs one baseline().  Registering benchmarks after celero::Run() has begun is not supported.
+	///
+	class CELERO_EXPORT Registrar
+	{
+	public:
+		using Function = std::function<void(State&)>;
+		using CountFunction = std::function<int64_t(const TestFixture::ExperimentValue*)>;
+
+		Registrar(const std::string& groupName, const std::string& benchmarkName);
+		~Registrar();
+
+		///
+		/// Copies all settings, so the copy can be changed independently.
+		///
+		Registrar(const Registrar& other);
+		Registrar& operator=(const Registrar& other);
+
+		Registrar(Registrar&&) = default;
+		Registrar& operator=(Registrar&&) = default;
+
+		///
+		/// Registers a baseline instead of a benchmark.
+		///
+		Registrar& baseline();
+
+		///
+		/// The number of samples.  Zero (the default) lets Celero choose.
+		///
+		Registrar& samples(uint64_t x);
+
+		///
+		/// The number of iterations per sample.  Zero (the default) lets Celero choose.
+		///
+		Registrar& iterations(uint64_t x);
+
+		///
+		/// The number of threads which run the benchmark concurrently.  More than one uses a ThreadTestFixture.  Defaults to one.
+		///
+		Registrar& threads(uint64_t x);
+
+		///
+		/// The baseline-relative target of a benchmark, as for BENCHMARK_TEST_F.  Ignored for a baseline.
+		///
+		Registrar& target(double x);
+
+		///
+		/// The problem space values to run the benchmark over.  Defaults to none.
+		///
+		Registrar& problemSpace(const std::vector<std::shared_ptr<TestFixture::ExperimentValue>>& x);
+
+		///
+		/// The problem space values built from the given ProblemSpace.
+		///
+		Registrar& problemSpace(const ProblemSpace& x);
+
+		///
+		/// Called before each sample, outside of the measurement, as TestFixture::setUp.
+		///
+		Registrar& setUp(Function x);
+
+		///
+		/// Called after each sample, outside of the measurement, as TestFixture::tearDown.
+		///
+		Registrar& tearDown(Function x);
+
+		///
+		/// The number of bytes one iteration of the given problem space value processes, as TestFixture::getBytesPerIteration.
+		///
+		Registrar& bytesPerIteration(CountFunction x);
+
+		///
+		/// The same number of bytes for every problem space value.
+		///
+		Registrar& bytesPerIteration(int64_t x);
+
+		///
+		/// The number of items one iteration of the given problem space value processes, as TestFixture::getItemsPerIteration.
+		///
+		Registrar& itemsPerIteration(CountFunction x);
+
+		///
+		/// The same number of items for every problem space value.
+		///
+		Registrar& itemsPerIteration(int64_t x);
+
+		///
+		/// Registers the benchmark with the given body, which is called once per iteration.
+		///
+		/// Each fixture created for the benchmark has its own State, but shares the functions (and anything they capture) with every other
+		/// fixture.  This Registrar can be changed and run again to register further benchmarks.
+		///
+		/// \return	The benchmark group the experiment was added to, or nullptr if the body is empty.
+		///
+		std::shared_ptr<Benchmark> run(Function x);
+
+	private:
+		std::shared_ptr<impl::RegistrarDefinition> definition;
+	};
+
+	///
+	/// \brief	Starts the runtime registration of a benchmark.  Complete it with Registrar::run().
+	///
+	CELERO_EXPORT Registrar Register(const std::string& groupName, const std::string& benchmarkName);
+} // namespace celero
@@ -0,0 +1,144 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Export.h>
+#include <celero/GenericFactory.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace celero
+{
+	///
+	/// \class Registration
+	///
+	/// \author	John Farrier
+	///
+	/// A benchmark or baseline declared by the BENCHMARK and BASELINE macros.
+	///
+	/// Registrations are static objects holding only string literals, numbers, and a function pointer.  Constructing one links it into a
+	/// lock-free list and does nothing else, so a program with thousands of benchmarks pays almost nothing for them during static
+	/// initialization.  The TestVector turns pending registrations into benchmarks and experiments the first time it is used.
+	///
+	class CELERO_EXPORT Registration
+	{
+	public:
+		enum class Kind
+		{
+			Baseline,
+			Test
+		};
+
+		using FactoryCreator = std::shared_ptr<Factory> (*)();
+
+		Registration(Kind kind, const char* groupName, const char* benchmarkName, uint64_t samples, uint64_t iterations, uint64_t threads,
+					 FactoryCreator createFactory, double target = -1);
+
+		Registration(const Registration&) = delete;
+		Registration& operator=(const Registration&) = delete;
+
+		///
+		/// Removes all pending registrations from the list and returns them, most recent first.
+		///
+		static const Registration* TakePending();
+
+		///
+		/// The next older registration taken with this one by TakePending().
+		///
+		const Registration* getNext() const;
+
+		///
+		/// Adds this benchmark or baseline through RegisterTest() or RegisterBaseline().
+		///
+		void apply() const;
+
+	private:
+		const Kind kind;
+		const char* const groupName;
+		const char* const benchmarkName;
+		const uint64_t samples;
+		const uint64_t iterations;
+		const uint64_t threads;
+		const FactoryCreator createFactory;
+		const double target;
+		const Registration* next{nullptr};
+	};
+
+	///
+	/// \brief	Creates a GenericFactory for the fixture type.  Used as a Registration's FactoryCreator.
+	///
+	template <class T>
+	std::shared_ptr<Factory> CreateGenericFactory()
+	{
+		return std::make_shared<GenericFactory<T>>();
+	}
+
+	namespace impl
+	{
+		///
+		/// \brief	The name of one experiment of a BENCHMARK_TEMPLATE sweep, such as "Find<std::map<int, int>>".
+		///
+		/// \param typeList The stringized, parenthesized type list given to the macro.
+		/// \param index The position of the type in the list.
+		///
+		CELERO_EXPORT std::string TemplateBenchmarkName(const char* benchmarkName, const char* typeList, size_t index);
+	} // namespace impl
+
+	///
+	/// \class TemplateRegistration
+	///
+	/// \author	John Farrier
+	///
+	/// Registers one experiment per type for the BENCHMARK_TEMPLATE macros, in the order the types are listed.
+	///
+	template <template <typename> class Benchmark, typename... Types>
+	class TemplateRegistration;
+
+	template <template <typename> class Benchmark>
+	class TemplateRegistration<Benchmark>
+	{
+	public:
+		TemplateRegistration(const char*, const char*, const char*, uint64_t, uint64_t, uint64_t, size_t = 0)
+		{
+		}
+	};
+
+	template <template <typename> class Benchmark, typename T, typename... Types>
+	class TemplateRegistration<Benchmark, T, Types...>
+	{
+	public:
+		TemplateRegistration(const char* groupName, const char* benchmarkName, const char* typeList, uint64_t samples, uint64_t iterations,
+							 uint64_t threads, size_t index = 0)
+			: name(impl::TemplateBenchmarkName(benchmarkName, typeList, index)),
+			  registration(Registration::Kind::Test, groupName, this->name.c_str(), samples, iterations, threads,
+						   &CreateGenericFactory<Benchmark<T>>),
+			  rest(groupName, benchmarkName, typeList, samples, iterations, threads, index + 1)
+		{
+		}
+
+	private:
+		/// Declared first, as the registration keeps a pointer to it.
+		const std::string name;
+		const Registration registration;
+		const TemplateRegistration<Benchmark, Types...> rest;
+	};
+} // namespace celero
@@ -0,0 +1,126 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/ArchiveHistory.h>
+#include <celero/ExperimentResult.h>
+#include <celero/Export.h>
+#include <celero/Pimpl.h>
+
+#include <memory>
+#include <vector>
+
+namespace celero
+{
+	///
+	/// \class RegressionDetector
+	///
+	/// \author	John Farrier
+	///
+	/// Compares each new result against the archived history of the same experiment and problem space.
+	///
+	/// A result is a regression when its us/Iteration is more than the threshold percentage above the mean of the most recent archived
+	/// runs and, when at least two runs are available, also more than the given number of standard deviations above that mean.
+	///
+	class CELERO_EXPORT RegressionDetector
+	{
+	public:
+		///
+		/// Singleton
+		///
+		static RegressionDetector& Instance();
+
+		///
+		/// Enables or disables regression detection.  Disabled by default.
+		///
+		void setEnabled(bool x);
+
+		///
+		/// True if results are being checked for regressions.
+		///
+		bool getEnabled() const;
+
+		///
+		/// The percentage by which a result must exceed the archived mean to be flagged.  Defaults to 10.
+		///
+		void setThreshold(double x);
+
+		///
+		/// The number of archived standard deviations by which a result must exceed the archived mean to be flagged.  Defaults to 3.
+		///
+		void setSigma(double x);
+
+		///
+		/// The number of most recent archived runs to compare against.  Defaults to 10.
+		///
+		void setWindow(size_t x);
+
+		///
+		/// Compares a single result against the given archived runs (oldest first) without recording anything.
+		///
+		/// \return	The mean us/Iteration of the archived runs when the result is a regression, or zero otherwise.
+		///
+		double check(double usPerCall, const std::vector<ArchiveHistoryPoint>& history) const;
+
+		///
+		/// Checks a completed result against the archive history and marks it when it has regressed.
+		///
+		/// Does nothing when detection is disabled, the result failed, or there is no archived history for it.
+		///
+		/// \return	True if the result has regressed.
+		///
+		bool evaluate(std::shared_ptr<celero::ExperimentResult> x);
+
+		///
+		/// The number of results flagged by evaluate().
+		///
+		size_t getRegressionCount() const;
+
+	private:
+		///
+		/// Default Constructor
+		///
+		RegressionDetector();
+
+		///
+		/// Non-copyable.
+		///
+		RegressionDetector(RegressionDetector&) = delete;
+
+		///
+		/// Default Destructor
+		///
+		~RegressionDetector();
+
+		///
+		/// Non-assignable.
+		///
+		RegressionDetector& operator=(const RegressionDetector&) = delete;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		class Impl;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		Pimpl<Impl> pimpl;
+	};
+} // namespace celero
@@ -22,6 +22,7 @@
 #include <celero/Pimpl.h>
 
 #include <string>
+#include <vector>
 
 namespace celero
 {
@@ -46,18 +47,27 @@ namespace celero
 		void setFileName(const std::string& x);
 
 		///
-		/// Force the output file (if any) to close
+		/// Specify the user-defined measurement columns of the table.
+		///
+		/// Columns are written in sorted order.  Fields found in results which were not given here are added to the table as well, and
+		/// results lacking a field leave its cell empty, so every row lines up with the header.
+		///
+		void setUserDefinedFields(const std::vector<std::string>& x);
+
+		///
+		/// Write the table, then force the output file (if any) to close
 		///
 		void closeFile();
+
 		///
 		/// Add a new result to the result table.
 		///
-		/// This should re-save on every new result so that the output can be monitored externally.
+		/// The row is formatted once, here, and buffered until the table is saved.
 		///
 		void add(std::shared_ptr<celero::ExperimentResult> x);
 
 		///
-		///
+		/// Write the header and every buffered row to the output file with a single write, replacing its contents.
 		///
 		void save();
 
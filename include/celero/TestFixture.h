@@ -18,6 +18,7 @@
 /// limitations under the License.
 ///
 
+#include <celero/Cache.h>
 #include <celero/Export.h>
 #include <celero/Timer.h>
 
@@ -26,6 +27,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 // This must be included last.
@@ -67,6 +69,28 @@ namespace celero
 #endif
 		};
 
+		///
+		/// How long a test fixture instance is kept.
+		///
+		/// Fixtures are always created fresh for each experiment.  Keeping one for longer than a sample avoids paying for expensive
+		/// construction and destruction (and the page faults of newly allocated data) inside every sample.  setUp and tearDown are still
+		/// called around every sample.
+		///
+		enum class FixtureLifetime : int
+		{
+			/// Use the default, which is PerSample unless changed with --fixtureLifetime.
+			Default,
+
+			/// A new fixture for every sample, calibration run, and warm-up run.
+			PerSample,
+
+			/// One fixture for all runs of a problem space.
+			PerProblemSpace,
+
+			/// One fixture for all problem spaces of the experiment.  onReuse is called between problem spaces.
+			PerExperiment
+		};
+
 		///
 		/// \class ExperimentValue
 		///
@@ -87,6 +111,54 @@ namespace celero
 			/// The number of iterations to do with this test value.  0 (default) indicates that the default number of iterations set up for the test
 			/// case should be used.
 			int64_t Iterations{0};
+
+			/// The named axes of a multi-dimensional problem space, in axis order (see celero::ProblemSpace).  Empty for a one-dimensional
+			/// problem space, which is described by Value alone.
+			std::vector<std::pair<std::string, int64_t>> Parameters;
+
+			///
+			/// The value of the named axis, or the given default if there is no such axis.
+			///
+			int64_t getParameter(const std::string& name, int64_t defaultValue = 0) const
+			{
+				for(const auto& i : this->Parameters)
+				{
+					if(i.first == name)
+					{
+						return i.second;
+					}
+				}
+
+				return defaultValue;
+			}
+
+			///
+			/// The parameters as "name=value;name=value", or an empty string for a one-dimensional problem space.
+			///
+			std::string getParameterString() const
+			{
+				std::string x;
+
+				for(const auto& i : this->Parameters)
+				{
+					if(x.empty() == false)
+					{
+						x += ";";
+					}
+
+					x += i.first + "=" + std::to_string(i.second);
+				}
+
+				return x;
+			}
+
+			///
+			/// True if both describe the same point in the problem space: the same Value and the same parameters.
+			///
+			bool isSameProblemSpace(const ExperimentValue& other) const
+			{
+				return (this->Value == other.Value) && (this->Parameters == other.Parameters);
+			}
 		};
 
 		///
@@ -120,6 +192,30 @@ namespace celero
 			return 1.0;
 		};
 
+		///
+		/// The number of bytes one iteration of the given problem space reads or writes, used to report bandwidth.
+		///
+		/// Zero (the default) reports no bandwidth.  A fixture without problem space values is passed a value of NoProblemSpaceValue.
+		///
+		/// It is only guaranteed that the constructor is called prior to this function being called.
+		///
+		virtual int64_t getBytesPerIteration(const celero::TestFixture::ExperimentValue* const) const
+		{
+			return 0;
+		}
+
+		///
+		/// The number of items (records, messages, tokens, ...) one iteration of the given problem space processes, used to report throughput.
+		///
+		/// Zero (the default) reports no item throughput.  A fixture without problem space values is passed a value of NoProblemSpaceValue.
+		///
+		/// It is only guaranteed that the constructor is called prior to this function being called.
+		///
+		virtual int64_t getItemsPerIteration(const celero::TestFixture::ExperimentValue* const) const
+		{
+			return 0;
+		}
+
 		///
 		/// Allows the text fixture to run code that will be executed once immediately before the benchmark.
 		///
@@ -137,6 +233,23 @@ namespace celero
 		///
 		virtual void onExperimentEnd();
 
+		///
+		/// Allows a test fixture to choose how long Celero keeps each instance.
+		///
+		/// It is only guaranteed that the constructor is called prior to this function being called.
+		///
+		virtual FixtureLifetime getFixtureLifetime() const;
+
+		///
+		/// Called when a fixture with a FixtureLifetime of PerExperiment is about to be used for its next problem space.
+		///
+		/// This code is NOT included in the benchmark timing.  Rebuild anything that depended on the previous problem space here.
+		/// Measurements from getUserDefinedMeasurements are reset by Celero before each problem space's samples.
+		///
+		/// \param x The celero::TestFixture::ExperimentValue of the next problem space.
+		///
+		virtual void onReuse(const celero::TestFixture::ExperimentValue* const x);
+
 		///
 		/// Set up the test fixture before benchmark execution.
 		///
@@ -199,6 +312,34 @@ namespace celero
 		///
 		std::vector<std::string> getUserDefinedMeasurementNames() const;
 
+		///
+		/// Stops the timer of the current sample until resumeTiming() is called.
+		///
+		/// Use this to exclude per-iteration preparation, such as reshuffling the input of a sort, from the measurement.  It may be called
+		/// from UserBenchmark, onExperimentStart, or onExperimentEnd.  The calibrated cost of a pause/resume pair is subtracted as well.
+		/// Not supported by ThreadTestFixture.
+		///
+		void pauseTiming();
+
+		///
+		/// Restarts the timer of the current sample after pauseTiming().
+		///
+		void resumeTiming();
+
+		///
+		/// Reports the duration of the current iteration, in nanoseconds, for fixtures that time their benchmark themselves.
+		///
+		/// Once this is called during a sample, the sample's time is the sum of the reported durations instead of the measured time.
+		///
+		void setIterationTime(uint64_t nanoseconds);
+
+		///
+		/// \brief Describes the memory used by the benchmark, for the cache::Method::Evict cold-cache method.
+		///
+		/// Called after setUp, so the regions may refer to data set up for the current sample.
+		///
+		virtual std::vector<celero::cache::Region> getColdCacheRegions() const;
+
 	protected:
 		/// Executed for each operation the benchmarking test is run.
 		virtual void UserBenchmark();
@@ -208,9 +349,27 @@ namespace celero
 		///
 		virtual uint64_t HardCodedMeasurement() const;
 
+		///
+		/// Empties the CPU caches according to the cold-cache method, when cold-cache mode is on.  Never call this inside a timed region.
+		///
+		void makeCachesCold() const;
+
+		///
+		/// Applies pauseTiming() and setIterationTime() to the measured time of a sample, in microseconds.
+		///
+		uint64_t getAdjustedSampleTime(uint64_t measured) const;
+
 	private:
 		uint64_t experimentIterations{0};
 		uint64_t experimentTime{0};
+
+		/// Per-sample timing adjustments, all in nanoseconds.
+		uint64_t pauseStartTime{0};
+		uint64_t pausedTime{0};
+		uint64_t pauseCount{0};
+		uint64_t manualTime{0};
+		bool isPaused{false};
+		bool isManuallyTimed{false};
 	};
 } // namespace celero
 
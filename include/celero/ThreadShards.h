@@ -0,0 +1,150 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/UserDefinedMeasurement.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace celero
+{
+	///
+	/// \class ThreadShards
+	///
+	/// \author	John Farrier
+	///
+	/// One private copy of a user-defined measurement's state for each worker thread of a ThreadTestFixture.
+	///
+	/// Workers update their own copy without locking.  Copies are aligned to cache lines so that no two workers write to the same one, and are
+	/// folded into the shared state with T's operator+= once the workers stop.
+	///
+	template <typename T>
+	class ThreadShards
+	{
+	public:
+		///
+		/// The calling worker's copy, or the shared state for any thread which is not a worker.
+		///
+		T& local(T& shared)
+		{
+			// Outside of a ThreadTestFixture there are no copies, so don't look up the thread's index at all.
+			if(this->shards.empty() == true)
+			{
+				return shared;
+			}
+
+			const auto shard = UserDefinedMeasurement::GetThreadShard();
+
+			if(shard == 0 || shard > this->shards.size())
+			{
+				return shared;
+			}
+
+			return this->shards[shard - 1].value;
+		}
+
+		///
+		/// Creates one empty copy per worker.
+		///
+		void begin(size_t threads)
+		{
+			this->shards.assign(threads, Shard());
+		}
+
+		///
+		/// Adds every worker's copy to the shared state and discards the copies.
+		///
+		void fold(T& shared)
+		{
+			for(const auto& shard : this->shards)
+			{
+				shared += shard.value;
+			}
+
+			this->clear();
+		}
+
+		///
+		/// Discards the copies.
+		///
+		void clear()
+		{
+			this->shards.clear();
+		}
+
+	private:
+		enum : size_t
+		{
+			CacheLineSize = 64
+		};
+
+		struct alignas(CacheLineSize) Shard
+		{
+			T value{};
+		};
+
+		///
+		/// Allocates the copies on a cache line boundary, which std::allocator does not guarantee for over-aligned types before C++17.
+		///
+		template <typename U>
+		struct CacheLineAllocator
+		{
+			using value_type = U;
+
+			CacheLineAllocator() = default;
+
+			template <typename V>
+			CacheLineAllocator(const CacheLineAllocator<V>&)
+			{
+			}
+
+			U* allocate(size_t n)
+			{
+				// Room to move the start up to the next cache line, and to remember where the block really starts just before it.
+				const auto block = static_cast<char*>(::operator new(n * sizeof(U) + CacheLineSize + sizeof(void*)));
+				auto aligned = block + sizeof(void*);
+				aligned += (CacheLineSize - reinterpret_cast<uintptr_t>(aligned) % CacheLineSize) % CacheLineSize;
+				reinterpret_cast<void**>(aligned)[-1] = block;
+				return reinterpret_cast<U*>(aligned);
+			}
+
+			void deallocate(U* p, size_t)
+			{
+				::operator delete(reinterpret_cast<void**>(p)[-1]);
+			}
+
+			template <typename V>
+			bool operator==(const CacheLineAllocator<V>&) const
+			{
+				return true;
+			}
+
+			template <typename V>
+			bool operator!=(const CacheLineAllocator<V>&) const
+			{
+				return false;
+			}
+		};
+
+		std::vector<Shard, CacheLineAllocator<Shard>> shards;
+	};
+} // namespace celero
@@ -41,6 +41,13 @@ namespace celero
 		///
 		CELERO_EXPORT uint64_t GetSystemTime();
 
+		///
+		///	\brief	Retrieves the current time from a monotonic, low-overhead clock, in nanoseconds.
+		///
+		/// Only differences between two calls are meaningful.
+		///
+		CELERO_EXPORT uint64_t GetSystemTimeNs();
+
 		///
 		///	\brief	Converts the gathered system time into seconds.
 		///
@@ -20,6 +20,8 @@
 
 #include <celero/Export.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -71,9 +73,87 @@ namespace celero
 		///
 		virtual void merge(const UserDefinedMeasurement* const x) = 0;
 
+		///
+		/// \brief Discard all values recorded so far.
+		///
+		/// Called when a test fixture is kept across samples or problem spaces, so that calibration and warm-up runs, and earlier problem
+		/// spaces, are not counted.
+		///
+		virtual void reset()
+		{
+		}
+
+		///
+		/// \brief Prepare one private accumulator per worker thread.
+		///
+		/// Called by ThreadTestFixture before its worker threads start, so that values added from the workers do not race with each other.
+		///
+		virtual void beginThreads(size_t /*threads*/)
+		{
+		}
+
+		///
+		/// \brief Fold the values recorded by the worker threads into this measurement.
+		///
+		/// Called by ThreadTestFixture after its worker threads have stopped.
+		///
+		virtual void endThreads()
+		{
+		}
+
+		///
+		/// \brief Called after every recorded sample with the sample's measured time, in microseconds, and the number of iterations it ran.
+		///
+		/// Measurements which report rates accumulate these, so that their rates use the same time base as the benchmark itself.
+		///
+		virtual void onSample(uint64_t /*sampleTime*/, uint64_t /*iterations*/)
+		{
+		}
+
+#if defined(_WIN32) && !defined(CELERO_STATIC)
+		// Each module using a DLL would have its own copy of an inline function's thread_local, so the index lives in the library.
+
+		///
+		/// \brief Sets the worker index (one-based) of the calling thread.  Zero, the default, is any thread which is not a worker.
+		///
+		static void SetThreadShard(size_t x);
+
+		///
+		/// \brief The worker index of the calling thread, as set by SetThreadShard.
+		///
+		static size_t GetThreadShard();
+#else
+		///
+		/// \brief Sets the worker index (one-based) of the calling thread.  Zero, the default, is any thread which is not a worker.
+		///
+		static void SetThreadShard(size_t x)
+		{
+			ThreadShard() = x;
+		}
+
+		///
+		/// \brief The worker index of the calling thread, as set by SetThreadShard.
+		///
+		/// Inline, since it is read by every addValue() from a worker.
+		///
+		static size_t GetThreadShard()
+		{
+			return ThreadShard();
+		}
+#endif
+
 	protected:
 		// Class may never be directly instantiated
 		UserDefinedMeasurement() = default;
+
+#if !defined(_WIN32) || defined(CELERO_STATIC)
+	private:
+		static size_t& ThreadShard()
+		{
+			static thread_local size_t shard{0};
+			return shard;
+		}
+#endif
 	};
 
 } // namespace celero
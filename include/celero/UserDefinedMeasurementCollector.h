@@ -20,7 +20,10 @@
 
 #include <celero/UserDefinedMeasurement.h>
 #include <celero/TestFixture.h>
-#include <unordered_map>
+
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace celero
 {
@@ -29,17 +32,56 @@ namespace celero
 	///
 	/// \author	Lukas Barth
 	///
+	/// Merges the user-defined measurements of every sample of one problem space.
+	///
+	/// Each measurement name has an integer slot.  The slot of each position in the fixture's getUserDefinedMeasurements() list is resolved by
+	/// name on the first collection.  Later collections only check that each position still holds a measurement of the same name, and
+	/// resolve it again if not.
+	///
 	class CELERO_EXPORT UserDefinedMeasurementCollector
 	{
 	public:
 		UserDefinedMeasurementCollector(std::shared_ptr<TestFixture> fixture);
 
+		///
+		/// Prepares to collect the named measurements without needing a fixture instance.
+		///
+		explicit UserDefinedMeasurementCollector(const std::vector<std::string>& names);
+
 		void collect(std::shared_ptr<TestFixture> fixture);
+
+		///
+		/// Merges measurements already obtained from a fixture's getUserDefinedMeasurements().
+		///
+		void collect(const std::vector<std::shared_ptr<UserDefinedMeasurement>>& udms);
+
 		std::vector<std::string> getFields(std::shared_ptr<TestFixture> fixture) const;
-		std::vector<std::pair<std::string, double>> getAggregateValues() const;
+
+		///
+		/// The value of every aggregate of every collected measurement, sorted by field name.
+		///
+		/// Once frozen, the values are computed only once.
+		///
+		const std::vector<std::pair<std::string, double>>& getAggregateValues() const;
+
+		///
+		/// Evaluates the aggregates now and keeps the values, so that the collected measurements may be reset or reused afterwards.
+		///
+		void freeze();
 
 	private:
-		std::unordered_map<std::string, std::shared_ptr<celero::UserDefinedMeasurement>> collected;
+		size_t getSlot(const std::string& name);
+
+		/// The measurement name of each slot.
+		std::vector<std::string> names;
+
+		/// The merged measurement of each slot, or nullptr while nothing was collected for it.
+		std::vector<std::shared_ptr<celero::UserDefinedMeasurement>> slots;
+
+		/// The slot of each position in the fixture's list of measurements, once resolved.
+		std::vector<size_t> slotOfPosition;
+
+		mutable std::vector<std::pair<std::string, double>> aggregates;
+		bool isFrozen{false};
 	};
 } // namespace celero
-
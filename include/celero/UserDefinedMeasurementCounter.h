@@ -0,0 +1,169 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/ThreadShards.h>
+#include <celero/UserDefinedMeasurement.h>
+
+#include <cstdint>
+
+namespace celero
+{
+	///
+	/// \class UserDefinedMeasurementCounter
+	///
+	/// \author	John Farrier
+	///
+	/// A user-defined measurement which counts events, such as cache hits or bytes written, and reports their total, their rate per second of
+	/// measured sample time, and their rate per iteration.
+	///
+	/// Use a counter when the total and the overall rate are what matter.  UserDefinedMeasurementRate reports the same overall rate, and
+	/// also how it varies between samples (its standard deviation, minimum, and maximum), at the cost of a little more work per sample.
+	///
+	/// Derive from this class and implement getName().
+	///
+	class UserDefinedMeasurementCounter : public UserDefinedMeasurement
+	{
+	public:
+		UDMAggregationTable getAggregationInfo() const override
+		{
+			UDMAggregationTable table;
+			table.push_back({"Sum", [this]() { return this->getSum(); }});
+			table.push_back({"Per Sec", [this]() { return this->getPerSecond(); }});
+			table.push_back({"Per Iter", [this]() { return this->getPerIteration(); }});
+			return table;
+		}
+
+		///
+		/// \brief You must call this method from your fixture to count events.  It may be called from ThreadTestFixture workers.
+		///
+		void addValue(double x)
+		{
+			this->shards.local(this->pending).sum += x;
+		}
+
+		///
+		/// Counts a single event.
+		///
+		void increment()
+		{
+			this->addValue(1.0);
+		}
+
+		///
+		/// The total of all counted events.
+		///
+		double getSum() const
+		{
+			return this->sum + this->pending.sum;
+		}
+
+		///
+		/// The events counted in timed samples divided by the total measured time of those samples.
+		///
+		double getPerSecond() const
+		{
+			return (this->sampleTime > 0) ? this->timedSum / (static_cast<double>(this->sampleTime) * 1.0e-6) : 0.0;
+		}
+
+		///
+		/// The events counted in timed samples divided by the total iterations of those samples.
+		///
+		double getPerIteration() const
+		{
+			return (this->iterations > 0) ? this->timedSum / static_cast<double>(this->iterations) : 0.0;
+		}
+
+		void merge(const UserDefinedMeasurement* const x) override
+		{
+			const auto toMerge = dynamic_cast<const UserDefinedMeasurementCounter* const>(x);
+			this->pending += toMerge->pending;
+			this->sum += toMerge->sum;
+			this->timedSum += toMerge->timedSum;
+			this->sampleTime += toMerge->sampleTime;
+			this->iterations += toMerge->iterations;
+		}
+
+		void reset() override
+		{
+			this->pending = Count();
+			this->shards.clear();
+			this->sum = 0.0;
+			this->timedSum = 0.0;
+			this->sampleTime = 0;
+			this->iterations = 0;
+		}
+
+		void beginThreads(size_t threads) override
+		{
+			this->shards.begin(threads);
+		}
+
+		void endThreads() override
+		{
+			this->shards.fold(this->pending);
+		}
+
+		///
+		/// A sample too short to be timed still adds its events to the sum, but not to the rates, which would otherwise be inflated.
+		///
+		void onSample(uint64_t x, uint64_t sampleIterations) override
+		{
+			const auto count = this->pending.sum;
+			this->pending = Count();
+
+			this->sum += count;
+
+			if(x > 0)
+			{
+				this->timedSum += count;
+				this->sampleTime += x;
+				this->iterations += sampleIterations;
+			}
+		}
+
+	private:
+		struct Count
+		{
+			Count& operator+=(const Count& other)
+			{
+				this->sum += other.sum;
+				return *this;
+			}
+
+			double sum{0.0};
+		};
+
+		/// The events counted in the current sample.
+		Count pending;
+		ThreadShards<Count> shards;
+
+		/// The events counted in all samples.
+		double sum{0.0};
+
+		/// The events counted in the samples with a measured time.
+		double timedSum{0.0};
+
+		/// The total measured time, in microseconds, of the timed samples recorded so far.
+		uint64_t sampleTime{0};
+
+		/// The total iterations of the timed samples recorded so far.
+		uint64_t iterations{0};
+	};
+} // namespace celero
@@ -0,0 +1,257 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/ThreadShards.h>
+#include <celero/UserDefinedMeasurement.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace celero
+{
+	///
+	/// \class UserDefinedMeasurementHistogram
+	///
+	/// \author	John Farrier
+	///
+	/// A user-defined measurement which reports percentiles, such as the median and the tail, of non-negative integer values.
+	///
+	/// Values are counted in log-linear buckets: exact below 32, and otherwise 32 buckets per power of two, so any percentile is within about
+	/// 1.6% of the true value.  The memory used is fixed, adding a value is a few instructions, and histograms merge by adding bucket counts.
+	///
+	/// Derive from this class and implement getName().  Override getPercentiles() to report other percentiles.
+	///
+	class UserDefinedMeasurementHistogram : public UserDefinedMeasurement
+	{
+	public:
+		UDMAggregationTable getAggregationInfo() const override
+		{
+			UDMAggregationTable table;
+
+			table.push_back({"# Samp", [this]() { return static_cast<double>(this->histogram.size); }});
+			table.push_back({"Mean", [this]() { return this->getMean(); }});
+			table.push_back({"Min", [this]() { return (this->histogram.size > 0) ? static_cast<double>(this->histogram.min) : 0.0; }});
+
+			for(const auto p : this->getPercentiles())
+			{
+				table.push_back({PercentileName(p), [this, p]() { return this->getPercentile(p); }});
+			}
+
+			table.push_back({"Max", [this]() { return static_cast<double>(this->histogram.max); }});
+			return table;
+		}
+
+		///
+		/// \brief You must call this method from your fixture to add a measurement.  It may be called from ThreadTestFixture workers.
+		///
+		void addValue(uint64_t x)
+		{
+			this->shards.local(this->histogram).add(x);
+		}
+
+		///
+		/// The number of values added.
+		///
+		uint64_t getSize() const
+		{
+			return this->histogram.size;
+		}
+
+		///
+		/// The exact mean of the values added.
+		///
+		double getMean() const
+		{
+			return (this->histogram.size > 0) ? this->histogram.sum / static_cast<double>(this->histogram.size) : 0.0;
+		}
+
+		///
+		/// The value below which the given percentage (0 to 100) of the values fall, to the resolution of the buckets.
+		///
+		double getPercentile(double p) const
+		{
+			if(this->histogram.size == 0)
+			{
+				return 0.0;
+			}
+
+			const auto rank = std::max(uint64_t(1), static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(this->histogram.size))));
+			uint64_t seen = 0;
+
+			for(size_t i = 0; i < BucketCount; ++i)
+			{
+				seen += this->histogram.counts[i];
+
+				if(seen >= rank)
+				{
+					// The middle of the bucket, but never outside the values actually seen.
+					const auto middle = static_cast<double>(BucketLow(i)) + static_cast<double>(BucketWidth(i) - 1) / 2.0;
+					return std::min(std::max(middle, static_cast<double>(this->histogram.min)), static_cast<double>(this->histogram.max));
+				}
+			}
+
+			return static_cast<double>(this->histogram.max);
+		}
+
+		void merge(const UserDefinedMeasurement* const x) override
+		{
+			const auto toMerge = dynamic_cast<const UserDefinedMeasurementHistogram* const>(x);
+			this->histogram += toMerge->histogram;
+		}
+
+		void reset() override
+		{
+			this->histogram = Histogram();
+			this->shards.clear();
+		}
+
+		void beginThreads(size_t threads) override
+		{
+			this->shards.begin(threads);
+		}
+
+		void endThreads() override
+		{
+			this->shards.fold(this->histogram);
+		}
+
+	protected:
+		///
+		/// The percentiles to report, from 0 to 100.  The default is the median, 99th, and 99.9th.
+		///
+		virtual std::vector<double> getPercentiles() const
+		{
+			return {50.0, 99.0, 99.9};
+		}
+
+	private:
+		static constexpr size_t SubBucketBits{5};
+		static constexpr uint64_t SubBuckets{uint64_t(1) << SubBucketBits};
+		static constexpr size_t BucketCount{(64 - SubBucketBits + 1) * SubBuckets};
+
+		struct Histogram
+		{
+			void add(uint64_t x)
+			{
+				this->counts[BucketOf(x)]++;
+				this->size++;
+				this->sum += static_cast<double>(x);
+				this->min = std::min(this->min, x);
+				this->max = std::max(this->max, x);
+			}
+
+			Histogram& operator+=(const Histogram& other)
+			{
+				for(size_t i = 0; i < BucketCount; ++i)
+				{
+					this->counts[i] += other.counts[i];
+				}
+
+				this->size += other.size;
+				this->sum += other.sum;
+				this->min = std::min(this->min, other.min);
+				this->max = std::max(this->max, other.max);
+				return *this;
+			}
+
+			std::array<uint64_t, BucketCount> counts{};
+			uint64_t size{0};
+			double sum{0.0};
+			uint64_t min{std::numeric_limits<uint64_t>::max()};
+			uint64_t max{0};
+		};
+
+		///
+		/// "p50" for 50, "p999" for 99.9.
+		///
+		static std::string PercentileName(double p)
+		{
+			auto digits = std::to_string(p);
+			digits.erase(digits.find_last_not_of('0') + 1);
+
+			if(digits.empty() == false && digits.back() == '.')
+			{
+				digits.pop_back();
+			}
+
+			digits.erase(std::remove(digits.begin(), digits.end(), '.'), digits.end());
+			return "p" + digits;
+		}
+
+		static size_t MostSignificantBit(uint64_t x)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return static_cast<size_t>(63 - __builtin_clzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+			unsigned long index;
+			_BitScanReverse64(&index, x);
+			return static_cast<size_t>(index);
+#else
+			size_t index = 0;
+
+			while(x >>= 1)
+			{
+				++index;
+			}
+
+			return index;
+#endif
+		}
+
+		static size_t BucketOf(uint64_t x)
+		{
+			if(x < SubBuckets)
+			{
+				return static_cast<size_t>(x);
+			}
+
+			const auto shift = MostSignificantBit(x) - SubBucketBits;
+			return static_cast<size_t>(((shift + 1) << SubBucketBits) + ((x >> shift) & (SubBuckets - 1)));
+		}
+
+		static uint64_t BucketLow(size_t i)
+		{
+			if(i < SubBuckets)
+			{
+				return i;
+			}
+
+			const auto shift = (i >> SubBucketBits) - 1;
+			return (SubBuckets + (i & (SubBuckets - 1))) << shift;
+		}
+
+		static uint64_t BucketWidth(size_t i)
+		{
+			return (i < SubBuckets) ? uint64_t(1) : (uint64_t(1) << ((i >> SubBucketBits) - 1));
+		}
+
+		Histogram histogram;
+		ThreadShards<Histogram> shards;
+	};
+} // namespace celero
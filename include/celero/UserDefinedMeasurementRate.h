@@ -0,0 +1,186 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/ThreadShards.h>
+#include <celero/UserDefinedMeasurement.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace celero
+{
+	///
+	/// \class UserDefinedMeasurementRate
+	///
+	/// \author	John Farrier
+	///
+	/// A user-defined measurement which reports how fast events happen, such as messages routed or bytes compressed, per second of measured
+	/// sample time and per iteration.
+	///
+	/// The events counted during each sample are divided by that sample's measured time.  The reported rate, its standard deviation, and its
+	/// extremes are weighted by sample time, so a long sample counts for more than a short one and the mean rate is exactly the total count
+	/// divided by the total time.  A sample too short to be timed has no rate, so its events are left out entirely.
+	///
+	/// Use a rate when the variation between samples matters.  UserDefinedMeasurementCounter reports the same overall rate along with the
+	/// total, without the per-sample statistics.
+	///
+	/// Derive from this class and implement getName().
+	///
+	class UserDefinedMeasurementRate : public UserDefinedMeasurement
+	{
+	public:
+		UDMAggregationTable getAggregationInfo() const override
+		{
+			UDMAggregationTable table;
+			table.push_back({"Per Sec", [this]() { return this->getPerSecond(); }});
+			table.push_back({"StdDev", [this]() { return this->getStandardDeviation(); }});
+			table.push_back({"Min", [this]() { return (this->samples > 0) ? this->min : 0.0; }});
+			table.push_back({"Max", [this]() { return (this->samples > 0) ? this->max : 0.0; }});
+			table.push_back({"Per Iter", [this]() { return this->getPerIteration(); }});
+			return table;
+		}
+
+		///
+		/// \brief You must call this method from your fixture to count events.  It may be called from ThreadTestFixture workers.
+		///
+		void addValue(double x)
+		{
+			this->shards.local(this->pending).count += x;
+		}
+
+		///
+		/// The events counted in all timed samples divided by the samples' total measured time.
+		///
+		double getPerSecond() const
+		{
+			return (this->sampleTime > 0) ? this->total / Seconds(this->sampleTime) : 0.0;
+		}
+
+		///
+		/// The events counted in all timed samples divided by the samples' total iterations.
+		///
+		double getPerIteration() const
+		{
+			return (this->iterations > 0) ? this->total / static_cast<double>(this->iterations) : 0.0;
+		}
+
+		///
+		/// The standard deviation of the rates of the individual samples, weighted by sample time.
+		///
+		double getStandardDeviation() const
+		{
+			if(this->sampleTime == 0)
+			{
+				return 0.0;
+			}
+
+			const auto mean = this->getPerSecond();
+			return std::sqrt(std::max(0.0, this->weightedSquares / Seconds(this->sampleTime) - mean * mean));
+		}
+
+		void onSample(uint64_t x, uint64_t sampleIterations) override
+		{
+			const auto count = this->pending.count;
+			this->pending = Pending();
+
+			if(x > 0)
+			{
+				const auto rate = count / Seconds(x);
+				this->total += count;
+				this->iterations += sampleIterations;
+				this->sampleTime += x;
+				this->weightedSquares += count * rate;
+				this->min = std::min(this->min, rate);
+				this->max = std::max(this->max, rate);
+				this->samples++;
+			}
+		}
+
+		void merge(const UserDefinedMeasurement* const x) override
+		{
+			const auto toMerge = dynamic_cast<const UserDefinedMeasurementRate* const>(x);
+			this->pending += toMerge->pending;
+			this->total += toMerge->total;
+			this->sampleTime += toMerge->sampleTime;
+			this->iterations += toMerge->iterations;
+			this->weightedSquares += toMerge->weightedSquares;
+			this->min = std::min(this->min, toMerge->min);
+			this->max = std::max(this->max, toMerge->max);
+			this->samples += toMerge->samples;
+		}
+
+		void reset() override
+		{
+			this->pending = Pending();
+			this->shards.clear();
+			this->total = 0.0;
+			this->sampleTime = 0;
+			this->iterations = 0;
+			this->weightedSquares = 0.0;
+			this->min = std::numeric_limits<double>::max();
+			this->max = std::numeric_limits<double>::lowest();
+			this->samples = 0;
+		}
+
+		void beginThreads(size_t threads) override
+		{
+			this->shards.begin(threads);
+		}
+
+		void endThreads() override
+		{
+			this->shards.fold(this->pending);
+		}
+
+	private:
+		static double Seconds(uint64_t microseconds)
+		{
+			return static_cast<double>(microseconds) * 1.0e-6;
+		}
+
+		/// The events counted in the current sample.
+		struct Pending
+		{
+			Pending& operator+=(const Pending& other)
+			{
+				this->count += other.count;
+				return *this;
+			}
+
+			double count{0.0};
+		};
+
+		Pending pending;
+		ThreadShards<Pending> shards;
+
+		double total{0.0};
+		uint64_t sampleTime{0};
+		uint64_t iterations{0};
+
+		/// The sum of each sample's rate squared times its time in seconds.
+		double weightedSquares{0.0};
+
+		double min{std::numeric_limits<double>::max()};
+		double max{std::numeric_limits<double>::lowest()};
+		uint64_t samples{0};
+	};
+} // namespace celero
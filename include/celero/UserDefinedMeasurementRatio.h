@@ -0,0 +1,113 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/ThreadShards.h>
+#include <celero/UserDefinedMeasurement.h>
+
+namespace celero
+{
+	///
+	/// \class UserDefinedMeasurementRatio
+	///
+	/// \author	John Farrier
+	///
+	/// A user-defined measurement which reports the ratio of two totals, such as cache hits to lookups.
+	///
+	/// Totals are kept rather than per-sample ratios, so merged results weigh every event equally.  Derive from this class and implement
+	/// getName().
+	///
+	class UserDefinedMeasurementRatio : public UserDefinedMeasurement
+	{
+	public:
+		UDMAggregationTable getAggregationInfo() const override
+		{
+			UDMAggregationTable table;
+			table.push_back({"Num", [this]() { return this->totals.numerator; }});
+			table.push_back({"Den", [this]() { return this->totals.denominator; }});
+			table.push_back({"Ratio", [this]() { return this->getRatio(); }});
+			return table;
+		}
+
+		///
+		/// \brief You must call this method from your fixture to add to both totals.  It may be called from ThreadTestFixture workers.
+		///
+		void addValue(double numerator, double denominator)
+		{
+			auto& local = this->shards.local(this->totals);
+			local.numerator += numerator;
+			local.denominator += denominator;
+		}
+
+		///
+		/// Counts one event in the denominator, and also in the numerator when it was a hit.
+		///
+		void addValue(bool hit)
+		{
+			this->addValue(hit ? 1.0 : 0.0, 1.0);
+		}
+
+		///
+		/// The numerator total divided by the denominator total, or zero when nothing was added.
+		///
+		double getRatio() const
+		{
+			return (this->totals.denominator != 0.0) ? this->totals.numerator / this->totals.denominator : 0.0;
+		}
+
+		void merge(const UserDefinedMeasurement* const x) override
+		{
+			const auto toMerge = dynamic_cast<const UserDefinedMeasurementRatio* const>(x);
+			this->totals += toMerge->totals;
+		}
+
+		void reset() override
+		{
+			this->totals = Totals();
+			this->shards.clear();
+		}
+
+		void beginThreads(size_t threads) override
+		{
+			this->shards.begin(threads);
+		}
+
+		void endThreads() override
+		{
+			this->shards.fold(this->totals);
+		}
+
+	private:
+		struct Totals
+		{
+			Totals& operator+=(const Totals& other)
+			{
+				this->numerator += other.numerator;
+				this->denominator += other.denominator;
+				return *this;
+			}
+
+			double numerator{0.0};
+			double denominator{0.0};
+		};
+
+		Totals totals;
+		ThreadShards<Totals> shards;
+	};
+} // namespace celero
@@ -19,6 +19,7 @@
 ///
 
 #include <celero/Statistics.h>
+#include <celero/ThreadShards.h>
 #include <celero/UserDefinedMeasurement.h>
 
 #include <numeric>
@@ -107,9 +108,12 @@ namespace celero
 		///
 		/// \brief You must call this method from your fixture to add a measurement
 		///
+		/// It may be called from the worker threads of a ThreadTestFixture: each worker adds to its own shard, without locking, and the shards
+		/// are folded together once the workers stop.
+		///
 		void addValue(T x)
 		{
-			this->stats.addSample(x);
+			this->shards.local(this->stats).addSample(x);
 		}
 
 		///
@@ -121,6 +125,31 @@ namespace celero
 			this->stats += toMerge->stats;
 		}
 
+		///
+		/// Discard all values recorded so far.
+		///
+		void reset() override
+		{
+			this->stats.reset();
+			this->shards.clear();
+		}
+
+		///
+		/// Give each worker thread its own shard.
+		///
+		void beginThreads(size_t threads) override
+		{
+			this->shards.begin(threads);
+		}
+
+		///
+		/// Fold the shards of the worker threads into this measurement.
+		///
+		void endThreads() override
+		{
+			this->shards.fold(this->stats);
+		}
+
 	protected:
 		virtual bool reportSize() const
 		{
@@ -175,6 +204,9 @@ namespace celero
 	private:
 		/// Continuously gathers statistics without having to retain data history.
 		Statistics<T> stats;
+
+		/// One entry per worker thread while a ThreadTestFixture is running.
+		ThreadShards<Statistics<T>> shards;
 	};
 
 } // namespace celero
@@ -26,16 +26,67 @@
 #include <stdio.h>
 #endif
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include <atomic>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
+#include <string>
 #include <thread>
+#include <type_traits>
 
 #include <celero/Export.h>
 
 namespace celero
 {
+	namespace impl
+	{
+		///
+		/// Reads through the pointer in a way the optimizer cannot see.  Used where inline assembly is not available.
+		///
+		CELERO_EXPORT void UseCharPointer(const volatile char*);
+
+		///
+		/// Replaces the target file with the source file in one step, so the target is either left untouched or fully replaced.
+		///
+		CELERO_EXPORT bool AtomicReplaceFile(const std::string& source, const std::string& target);
+
+#if defined(__GNUC__) || defined(__clang__)
+		///
+		/// Small trivially copyable values may stay in a register.
+		///
+		template <class T>
+		inline typename std::enable_if<std::is_trivially_copyable<T>::value && (sizeof(T) <= sizeof(T*))>::type CompilerBarrier(const T& x)
+		{
+			asm volatile("" : : "r,m"(x) : "memory");
+		}
+
+		///
+		/// Everything else is referenced in memory, which avoids copying it into a register first.
+		///
+		template <class T>
+		inline typename std::enable_if<(std::is_trivially_copyable<T>::value == false) || (sizeof(T) > sizeof(T*))>::type CompilerBarrier(const T& x)
+		{
+			asm volatile("" : : "m"(x) : "memory");
+		}
+#else
+		template <class T>
+		inline void CompilerBarrier(const T& x)
+		{
+			UseCharPointer(&reinterpret_cast<const volatile char&>(x));
+#ifdef _MSC_VER
+			_ReadWriteBarrier();
+#else
+			std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+		}
+#endif
+	} // namespace impl
+
 	///
 	/// \func DoNotOptimizeAway
 	///
@@ -89,53 +140,54 @@ namespace celero
 	///
 	/// gcc.godbolt.org permalink: http://goo.gl/lsngwX
 	///
-	/// Folly uses a simple bit of inline assembly:
-	/// > template <class T>
-	/// > void doNotOptimizeAway(T&& datum) {
-	///	> asm volatile("" : "+r" (datum));
-	/// >}
-	///
-	/// It would be great if that were portable with respect to both compilers and 32/64-bit targets.
+	/// With GCC and Clang, the value is passed to an empty inline assembly statement which the compiler must assume reads it and may read
+	/// or write any memory.  No instructions are emitted, so the cost within a benchmark is only that of keeping the value materialized in a
+	/// register or in memory.  Other compilers fall back to reading the value's address through a function the optimizer cannot see into,
+	/// followed by a compiler barrier.
 	///
 	template <class T>
-	void DoNotOptimizeAway(T&& x)
+	inline void DoNotOptimizeAway(T&& x)
 	{
-		static auto ttid = std::this_thread::get_id();
-		if(ttid == std::thread::id())
-		{
-			// This forces the value to never be optimized away
-			// by taking a reference then using it.
-			const auto* p = &x;
-			putchar(*reinterpret_cast<const char*>(p));
-
-			// If we do get here, kick out because something has gone wrong.
-			std::abort();
-		}
+		impl::CompilerBarrier(x);
 	}
 
 	/// Specialization for std::function objects which return a value.
 	template <class T>
-	void DoNotOptimizeAway(std::function<T(void)>&& x)
+	inline void DoNotOptimizeAway(std::function<T(void)>&& x)
 	{
-		volatile auto foo = x();
-
-		static auto ttid = std::this_thread::get_id();
-		if(ttid == std::thread::id())
-		{
-			// This forces the value to never be optimized away
-			// by taking a reference then using it.
-			const auto* p = &foo + &x;
-			putchar(*reinterpret_cast<const char*>(p));
-
-			// If we do get here, kick out because something has gone wrong.
-			std::abort();
-		}
+		auto foo = x();
+		impl::CompilerBarrier(foo);
 	}
 
 	/// Specialization for std::function objects which return void.
 	template <>
 	CELERO_EXPORT void DoNotOptimizeAway(std::function<void(void)>&& x);
 
+	///
+	/// \func ClobberMemory
+	///
+	/// Forces the compiler to assume all memory may have been read and written, so pending stores are performed and later loads are not
+	/// folded into earlier ones.  Emits no instructions under GCC and Clang.
+	///
+	/// \code
+	/// std::vector<int> v;
+	/// v.reserve(1);
+	/// celero::DoNotOptimizeAway(v.data());
+	/// v.push_back(42);
+	/// celero::ClobberMemory();  // The store of 42 must happen.
+	/// \endcode
+	///
+	inline void ClobberMemory()
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : : "memory");
+#elif defined(_MSC_VER)
+		_ReadWriteBarrier();
+#else
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+	}
+
 	///
 	/// Quick definition of the number of microseconds per second.
 	///
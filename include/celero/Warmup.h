@@ -0,0 +1,130 @@
+#pragma once
+
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Export.h>
+#include <celero/Pimpl.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace celero
+{
+	///
+	/// \class Warmup
+	///
+	/// \author	John Farrier
+	///
+	/// Decides how many unrecorded samples are run before each problem space is measured.
+	///
+	/// Page faults, branch predictor training, CPU frequency ramp-up, and lazily filled allocator pools can take more than one sample to
+	/// settle.  Warm-up samples are kept separately on each result so that cold-start cost can be compared to the steady state.
+	///
+	class CELERO_EXPORT Warmup
+	{
+	public:
+		///
+		/// How the end of the warm-up is decided.
+		///
+		enum class Mode : int
+		{
+			/// A fixed number of samples.
+			Count,
+
+			/// Samples until a fixed wall-clock time has passed.
+			Duration,
+
+			/// Samples until consecutive samples agree within a percentage.
+			Stable
+		};
+
+		///
+		/// Singleton
+		///
+		static Warmup& Instance();
+
+		///
+		/// Warm up for exactly this many samples.  The default is a single sample.
+		///
+		void setCount(uint64_t x);
+
+		///
+		/// Warm up for at least this many microseconds, and at least one sample.
+		///
+		void setDuration(uint64_t x);
+
+		///
+		/// Warm up until the last "window" samples are within "percent" of each other, or until "maxSamples" samples have been run.
+		///
+		void setStable(double percent, size_t window = 3, uint64_t maxSamples = 100);
+
+		///
+		/// Sets the policy from a command line value: "N" samples, a duration such as "500us", "200ms" or "2s", or "stable:PERCENT" with
+		/// an optional ":MAXSAMPLES".
+		///
+		/// \return	False, leaving the policy unchanged, if the value could not be parsed.
+		///
+		bool setPolicy(const std::string& x);
+
+		///
+		/// The current policy.
+		///
+		Mode getMode() const;
+
+		///
+		/// \param samples	The warm-up sample times so far, in microseconds.
+		/// \param elapsed	The wall-clock microseconds spent warming up so far.
+		///
+		/// \return	True when no more warm-up samples are needed.
+		///
+		bool isComplete(const std::vector<uint64_t>& samples, uint64_t elapsed) const;
+
+	private:
+		///
+		/// Default Constructor
+		///
+		Warmup();
+
+		///
+		/// Non-copyable.
+		///
+		Warmup(Warmup&) = delete;
+
+		///
+		/// Default Destructor
+		///
+		~Warmup();
+
+		///
+		/// Non-assignable.
+		///
+		Warmup& operator=(const Warmup&) = delete;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		class Impl;
+
+		///
+		/// \brief	Pimpl Idiom
+		///
+		Pimpl<Impl> pimpl;
+	};
+} // namespace celero
@@ -21,175 +21,851 @@
 #include <celero/Benchmark.h>
 #include <celero/FileReader.h>
 #include <celero/PimplImpl.h>
+#include <celero/Utilities.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <sstream>
+#include <type_traits>
 #include <vector>
 
 using namespace celero;
 
-///
-/// Structure to assist with archiving data during runtime and to a file.
-///
-struct ArchiveEntry
+namespace
 {
-	static void WriteHeader(std::ostream& str)
-	{
-		str << "GroupName,RunName,Failure,ExperimentValue,ExperimentValueScale,FirstRanDate,TotalSamplesCollected,AverageBaseline,";
-		str << "MinBaseline,MinBaselineTimeSinceEpoch,";
-		str << "MinStatSize,MinStatMean,MinStatVariance,MinStatStandardDeviation,MinStatSkewness,MinStatKurtosis,";
-		str << "MinStatMin,MinStatMax,";
-		str << "MaxBaseline,MaxBaselineTimeSinceEpoch,";
-		str << "MaxStatSize,MaxStatMean,MaxStatVariance,MaxStatStandardDeviation,MaxStatSkewness,MaxStatKurtosis,";
-		str << "MaxStatMin,MaxStatMax,";
-		str << "CurrentBaseline,CurrentBaselineTimeSinceEpoch,";
-		str << "CurrentStatSize,CurrentStatMean,CurrentStatVariance,CurrentStatStandardDeviation,CurrentStatSkewness,CurrentStatKurtosis,";
-		str << "CurrentStatMin,CurrentStatMax" << std::endl;
+	///
+	/// Structure to assist with archiving data during runtime and to a file.
+	///
+	struct ArchiveEntry
+	{
+		static void WriteHeader(std::ostream& str)
+		{
+			str << "GroupName,RunName,Failure,ExperimentValue,ExperimentValueScale,FirstRanDate,TotalSamplesCollected,AverageBaseline,";
+			str << "MinBaseline,MinBaselineTimeSinceEpoch,";
+			str << "MinStatSize,MinStatMean,MinStatVariance,MinStatStandardDeviation,MinStatSkewness,MinStatKurtosis,";
+			str << "MinStatMin,MinStatMax,";
+			str << "MaxBaseline,MaxBaselineTimeSinceEpoch,";
+			str << "MaxStatSize,MaxStatMean,MaxStatVariance,MaxStatStandardDeviation,MaxStatSkewness,MaxStatKurtosis,";
+			str << "MaxStatMin,MaxStatMax,";
+			str << "CurrentBaseline,CurrentBaselineTimeSinceEpoch,";
+			str << "CurrentStatSize,CurrentStatMean,CurrentStatVariance,CurrentStatStandardDeviation,CurrentStatSkewness,CurrentStatKurtosis,";
+			str << "CurrentStatMin,CurrentStatMax,Parameters,BytesPerIteration,ItemsPerIteration" << std::endl;
+		}
+
+		struct Stat
+		{
+			Stat& operator=(const celero::Statistics<int64_t>& s)
+			{
+				this->Size = s.getSize();
+				this->Mean = s.getMean();
+				this->Variance = s.getVariance();
+				this->StandardDeviation = s.getStandardDeviation();
+				this->Skewness = s.getSkewness();
+				this->Kurtosis = s.getKurtosis();
+				this->Min = s.getMin();
+				this->Max = s.getMax();
+
+				return *this;
+			}
+
+			uint64_t Size{0};
+			double Mean{0};
+			double Variance{0};
+			double StandardDeviation{0};
+			double Skewness{0};
+			double Kurtosis{0};
+			uint64_t Min{0};
+			uint64_t Max{0};
+		};
+
+		std::string GroupName;
+		std::string RunName;
+
+		/// The data set size, if one was specified.
+		int64_t ExperimentValue{0};
+		double ExperimentValueScale{0};
+
+		/// The named parameters of a multi-dimensional problem space as "name=value;name=value", or empty.
+		std::string Parameters;
+
+		/// What one iteration processes, as reported by the fixture, or zero.
+		int64_t BytesPerIteration{0};
+		int64_t ItemsPerIteration{0};
+
+		uint64_t FirstRanDate{0};
+		uint32_t TotalSamplesCollected{0};
+
+		double AverageBaseline{0};
+
+		double MinBaseline{0};
+		uint64_t MinBaseline_TimeSinceEpoch{0};
+		Stat MinStats;
+
+		double MaxBaseline{0};
+		uint64_t MaxBaseline_TimeSinceEpoch{0};
+		Stat MaxStats;
+
+		double CurrentBaseline{0};
+		uint64_t CurrentBaseline_TimeSinceEpoch{0};
+		Stat CurrentStats;
+
+		bool Failure{false};
+	};
+
+	///
+	/// Overload operator<< to allow for easy output of result data to a human-readable text file.
+	///
+	std::ostream& operator<<(std::ostream& str, ArchiveEntry::Stat const& data)
+	{
+		str << data.Size << ",";
+		str << data.Mean << ",";
+		str << data.Variance << ",";
+		str << data.StandardDeviation << ",";
+		str << data.Skewness << ",";
+		str << data.Kurtosis << ",";
+		str << data.Min << ",";
+		str << data.Max;
+		return str;
 	}
 
-	struct Stat
+	///
+	/// Overload operator<< to allow for easy output of result data to a human-readable text file.
+	///
+	std::ostream& operator<<(std::ostream& str, ArchiveEntry const& data)
 	{
-		Stat& operator=(const celero::Statistics<int64_t>& s)
+		str << data.GroupName << ",";
+		str << data.RunName << ",";
+		str << data.Failure << ",";
+		str << data.ExperimentValue << ",";
+		str << data.ExperimentValueScale << ",";
+		str << data.FirstRanDate << ",";
+		str << data.TotalSamplesCollected << ",";
+		str << data.AverageBaseline << ",";
+		str << data.MinBaseline << ",";
+		str << data.MinBaseline_TimeSinceEpoch << ",";
+		str << data.MinStats << ",";
+		str << data.MaxBaseline << ",";
+		str << data.MaxBaseline_TimeSinceEpoch << ",";
+		str << data.MaxStats << ",";
+		str << data.CurrentBaseline << ",";
+		str << data.CurrentBaseline_TimeSinceEpoch << ",";
+		str << data.CurrentStats;
+
+		// The trailing fields are only written when set, keeping other rows readable by older versions.
+		if(data.Parameters.empty() == false || data.BytesPerIteration != 0 || data.ItemsPerIteration != 0)
 		{
-			this->Size = s.getSize();
-			this->Mean = s.getMean();
-			this->Variance = s.getVariance();
-			this->StandardDeviation = s.getStandardDeviation();
-			this->Skewness = s.getSkewness();
-			this->Kurtosis = s.getKurtosis();
-			this->Min = s.getMin();
-			this->Max = s.getMax();
+			str << "," << data.Parameters;
+
+			if(data.BytesPerIteration != 0 || data.ItemsPerIteration != 0)
+			{
+				str << "," << data.BytesPerIteration << "," << data.ItemsPerIteration;
+			}
+		}
+
+		str << std::endl;
+		return str;
+	}
+
+	///
+	/// Overload operator>> to allow for easy input of result data from a text file.
+	///
+	std::istream& operator>>(std::istream& str, ArchiveEntry::Stat& data)
+	{
+		// Use FieldReader to classify commas as whitespace.
+		str.imbue(std::locale(std::locale(), new celero::FieldReader));
+
+		str >> data.Size;
+		str >> data.Mean;
+		str >> data.Variance;
+		str >> data.StandardDeviation;
+		str >> data.Skewness;
+		str >> data.Kurtosis;
+		str >> data.Min;
+		str >> data.Max;
+		return str;
+	}
+
+	///
+	/// Overload operator>> to allow for easy input of result data from a text file.
+	///
+	std::istream& operator>>(std::istream& str, ArchiveEntry& data)
+	{
+		// Use FieldReader to classify commas as whitespace.
+		str.imbue(std::locale(std::locale(), new celero::FieldReader));
+
+		str >> data.GroupName;
+		str >> data.RunName;
+		str >> data.Failure;
+		str >> data.ExperimentValue;
+		str >> data.ExperimentValueScale;
+		str >> data.FirstRanDate;
+		str >> data.TotalSamplesCollected;
+		str >> data.AverageBaseline;
+		str >> data.MinBaseline;
+		str >> data.MinBaseline_TimeSinceEpoch;
+		str >> data.MinStats;
+		str >> data.MaxBaseline;
+		str >> data.MaxBaseline_TimeSinceEpoch;
+		str >> data.MaxStats;
+		str >> data.CurrentBaseline;
+		str >> data.CurrentBaseline_TimeSinceEpoch;
+		str >> data.CurrentStats;
 
-			return *this;
+		// Parameters, BytesPerIteration, and ItemsPerIteration are optional trailing fields.  Archives written before they were added end the
+		// line after CurrentStats.
+		std::string rest;
+		std::getline(str, rest);
+		rest.erase(rest.find_last_not_of(" \t\r") + 1);
+
+		std::vector<std::string> fields;
+		std::istringstream trailing(rest);
+		std::string field;
+
+		while(std::getline(trailing, field, ','))
+		{
+			fields.push_back(field);
 		}
 
-		uint64_t Size{0};
-		double Mean{0};
-		double Variance{0};
-		double StandardDeviation{0};
-		double Skewness{0};
-		double Kurtosis{0};
-		uint64_t Min{0};
-		uint64_t Max{0};
+		// The line continues directly after CurrentStats, so the first field is the empty text before its comma.
+		data.Parameters = (fields.size() > 1) ? fields[1] : std::string();
+		data.BytesPerIteration = (fields.size() > 2) ? std::strtoll(fields[2].c_str(), nullptr, 10) : 0;
+		data.ItemsPerIteration = (fields.size() > 3) ? std::strtoll(fields[3].c_str(), nullptr, 10) : 0;
+		return str;
+	}
+
+	///
+	/// \struct ArchiveBinaryHeader
+	///
+	/// The first bytes of a binary archive file.
+	///
+	/// A binary archive is laid out as this header, followed by ArchiveBinaryHeader::RecordCount instances of ArchiveBinaryRecord, followed by a
+	/// string table of ArchiveBinaryHeader::StringTableSize bytes.  Strings are not null-terminated; records refer to them by offset and length.
+	/// All values are stored in the native byte order of the machine that wrote the file.
+	///
+	/// Each version only appends fields to the record: version 2 the problem space parameters, version 3 the bytes and items per iteration.
+	/// Records of older versions are a prefix of current records and are still read.
+	///
+	struct ArchiveBinaryHeader
+	{
+		static constexpr uint32_t CurrentVersion{3};
+		static constexpr uint32_t ByteOrderMark{0x01020304};
+
+		char Magic[8];
+		uint32_t Version;
+		uint32_t ByteOrder;
+		uint32_t HeaderSize;
+		uint32_t RecordSize;
+		uint64_t RecordCount;
+		uint64_t StringTableSize;
 	};
 
-	std::string GroupName;
-	std::string RunName;
+	///
+	/// \struct ArchiveBinaryRecord
+	///
+	/// A fixed-size, trivially copyable image of an ArchiveEntry.
+	///
+	struct ArchiveBinaryRecord
+	{
+		uint64_t GroupNameOffset;
+		uint64_t RunNameOffset;
+		uint32_t GroupNameLength;
+		uint32_t RunNameLength;
+		int64_t ExperimentValue;
+		double ExperimentValueScale;
+		uint64_t FirstRanDate;
+		uint32_t TotalSamplesCollected;
+		uint32_t Failure;
+		double AverageBaseline;
+		double MinBaseline;
+		uint64_t MinBaseline_TimeSinceEpoch;
+		ArchiveEntry::Stat MinStats;
+		double MaxBaseline;
+		uint64_t MaxBaseline_TimeSinceEpoch;
+		ArchiveEntry::Stat MaxStats;
+		double CurrentBaseline;
+		uint64_t CurrentBaseline_TimeSinceEpoch;
+		ArchiveEntry::Stat CurrentStats;
 
-	/// The data set size, if one was specified.
-	int64_t ExperimentValue{0};
-	double ExperimentValueScale{0};
+		// Version 2
+		uint64_t ParametersOffset;
+		uint32_t ParametersLength;
+		uint32_t Reserved;
 
-	uint64_t FirstRanDate{0};
-	uint32_t TotalSamplesCollected{0};
+		// Version 3
+		int64_t BytesPerIteration;
+		int64_t ItemsPerIteration;
+	};
 
-	double AverageBaseline{0};
+	///
+	/// The size of a record of the given version.  Zero for unknown versions.
+	///
+	constexpr size_t ArchiveBinaryRecordSize(uint32_t version)
+	{
+		return (version == 1) ? offsetof(ArchiveBinaryRecord, ParametersOffset)
+							  : (version == 2) ? offsetof(ArchiveBinaryRecord, BytesPerIteration) : (version == 3) ? sizeof(ArchiveBinaryRecord) : 0;
+	}
 
-	double MinBaseline{0};
-	uint64_t MinBaseline_TimeSinceEpoch{0};
-	Stat MinStats;
+	static_assert(std::is_trivially_copyable<ArchiveBinaryRecord>::value, "ArchiveBinaryRecord must be trivially copyable.");
+	static_assert(sizeof(ArchiveBinaryHeader) % 8 == 0, "ArchiveBinaryHeader must keep the records 8-byte aligned.");
+	static_assert(sizeof(ArchiveBinaryRecord) % 8 == 0, "ArchiveBinaryRecord must keep the records 8-byte aligned.");
 
-	double MaxBaseline{0};
-	uint64_t MaxBaseline_TimeSinceEpoch{0};
-	Stat MaxStats;
+	constexpr char ArchiveBinaryMagic[8] = {'C', 'E', 'L', 'E', 'R', 'O', 'A', 'R'};
 
-	double CurrentBaseline{0};
-	uint64_t CurrentBaseline_TimeSinceEpoch{0};
-	Stat CurrentStats;
+	///
+	/// \class MappedFile
+	///
+	/// A read-only memory map of an entire file.
+	///
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
 
-	bool Failure{false};
-};
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
 
-///
-/// Overload operator<< to allow for easy output of result data to a human-readable text file.
-///
-std::ostream& operator<<(std::ostream& str, ArchiveEntry::Stat const& data)
-{
-	str << data.Size << ",";
-	str << data.Mean << ",";
-	str << data.Variance << ",";
-	str << data.StandardDeviation << ",";
-	str << data.Skewness << ",";
-	str << data.Kurtosis << ",";
-	str << data.Min << ",";
-	str << data.Max;
-	return str;
-}
+		~MappedFile()
+		{
+			this->close();
+		}
 
-///
-/// Overload operator<< to allow for easy output of result data to a human-readable text file.
-///
-std::ostream& operator<<(std::ostream& str, ArchiveEntry const& data)
-{
-	str << data.GroupName << ",";
-	str << data.RunName << ",";
-	str << data.Failure << ",";
-	str << data.ExperimentValue << ",";
-	str << data.ExperimentValueScale << ",";
-	str << data.FirstRanDate << ",";
-	str << data.TotalSamplesCollected << ",";
-	str << data.AverageBaseline << ",";
-	str << data.MinBaseline << ",";
-	str << data.MinBaseline_TimeSinceEpoch << ",";
-	str << data.MinStats << ",";
-	str << data.MaxBaseline << ",";
-	str << data.MaxBaseline_TimeSinceEpoch << ",";
-	str << data.MaxStats << ",";
-	str << data.CurrentBaseline << ",";
-	str << data.CurrentBaseline_TimeSinceEpoch << ",";
-	str << data.CurrentStats << std::endl;
-	return str;
-}
+		bool open(const std::string& fileName)
+		{
+			this->close();
 
-///
-/// Overload operator>> to allow for easy input of result data from a text file.
-///
-std::istream& operator>>(std::istream& str, ArchiveEntry::Stat& data)
-{
-	// Use FieldReader to classify commas as whitespace.
-	str.imbue(std::locale(std::locale(), new celero::FieldReader));
-
-	str >> data.Size;
-	str >> data.Mean;
-	str >> data.Variance;
-	str >> data.StandardDeviation;
-	str >> data.Skewness;
-	str >> data.Kurtosis;
-	str >> data.Min;
-	str >> data.Max;
-	return str;
-}
+#ifdef _WIN32
+			this->file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
 
-///
-/// Overload operator>> to allow for easy input of result data from a text file.
-///
-std::istream& operator>>(std::istream& str, ArchiveEntry& data)
-{
-	// Use FieldReader to classify commas as whitespace.
-	str.imbue(std::locale(std::locale(), new celero::FieldReader));
-
-	str >> data.GroupName;
-	str >> data.RunName;
-	str >> data.Failure;
-	str >> data.ExperimentValue;
-	str >> data.ExperimentValueScale;
-	str >> data.FirstRanDate;
-	str >> data.TotalSamplesCollected;
-	str >> data.AverageBaseline;
-	str >> data.MinBaseline;
-	str >> data.MinBaseline_TimeSinceEpoch;
-	str >> data.MinStats;
-	str >> data.MaxBaseline;
-	str >> data.MaxBaseline_TimeSinceEpoch;
-	str >> data.MaxStats;
-	str >> data.CurrentBaseline;
-	str >> data.CurrentBaseline_TimeSinceEpoch;
-	str >> data.CurrentStats;
-	return str;
-}
+			if(this->file == INVALID_HANDLE_VALUE)
+			{
+				return false;
+			}
+
+			LARGE_INTEGER fileSize;
+
+			if((GetFileSizeEx(this->file, &fileSize) == FALSE) || (fileSize.QuadPart == 0))
+			{
+				this->close();
+				return false;
+			}
+
+			this->mapping = CreateFileMappingA(this->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+			if(this->mapping == nullptr)
+			{
+				this->close();
+				return false;
+			}
+
+			this->data = static_cast<const char*>(MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0));
+			this->size = static_cast<size_t>(fileSize.QuadPart);
+#else
+			const auto fd = ::open(fileName.c_str(), O_RDONLY);
+
+			if(fd < 0)
+			{
+				return false;
+			}
+
+			struct stat fileStat;
+
+			if((fstat(fd, &fileStat) != 0) || (fileStat.st_size <= 0))
+			{
+				::close(fd);
+				return false;
+			}
+
+			auto p = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+			// The mapping remains valid after the descriptor is closed.
+			::close(fd);
+
+			if(p == MAP_FAILED)
+			{
+				return false;
+			}
+
+			this->data = static_cast<const char*>(p);
+			this->size = static_cast<size_t>(fileStat.st_size);
+#endif
+
+			if(this->data == nullptr)
+			{
+				this->close();
+				return false;
+			}
+
+			return true;
+		}
+
+		void close()
+		{
+#ifdef _WIN32
+			if(this->data != nullptr)
+			{
+				UnmapViewOfFile(this->data);
+			}
+
+			if(this->mapping != nullptr)
+			{
+				CloseHandle(this->mapping);
+				this->mapping = nullptr;
+			}
+
+			if(this->file != INVALID_HANDLE_VALUE)
+			{
+				CloseHandle(this->file);
+				this->file = INVALID_HANDLE_VALUE;
+			}
+#else
+			if(this->data != nullptr)
+			{
+				munmap(const_cast<char*>(this->data), this->size);
+			}
+#endif
+
+			this->data = nullptr;
+			this->size = 0;
+		}
+
+		const char* getData() const
+		{
+			return this->data;
+		}
+
+		size_t getSize() const
+		{
+			return this->size;
+		}
+
+	private:
+#ifdef _WIN32
+		HANDLE file{INVALID_HANDLE_VALUE};
+		HANDLE mapping{nullptr};
+#endif
+
+		const char* data{nullptr};
+		size_t size{0};
+	};
+
+	///
+	/// \class ArchiveBinaryView
+	///
+	/// Provides direct access to the records of a memory-mapped binary archive without copying or parsing them.
+	///
+	class ArchiveBinaryView
+	{
+	public:
+		///
+		/// Map and validate a binary archive.  Returns false if the file is missing, truncated, or not a compatible binary archive.
+		///
+		bool open(const std::string& fileName)
+		{
+			this->close();
+
+			if(this->file.open(fileName) == false)
+			{
+				return false;
+			}
+
+			if(this->file.getSize() < sizeof(ArchiveBinaryHeader))
+			{
+				this->close();
+				return false;
+			}
+
+			this->header = reinterpret_cast<const ArchiveBinaryHeader*>(this->file.getData());
+
+			const auto recordSize = ArchiveBinaryRecordSize(this->header->Version);
+
+			if((std::memcmp(this->header->Magic, ArchiveBinaryMagic, sizeof(ArchiveBinaryMagic)) != 0) || (recordSize == 0)
+			   || (this->header->ByteOrder != ArchiveBinaryHeader::ByteOrderMark) || (this->header->HeaderSize != sizeof(ArchiveBinaryHeader))
+			   || (this->header->RecordSize != recordSize))
+			{
+				this->close();
+				return false;
+			}
+
+			// The counts come from the file, so they are checked against the space left before anything is multiplied or added.
+			const auto available = static_cast<uint64_t>(this->file.getSize() - sizeof(ArchiveBinaryHeader));
+
+			if(this->header->RecordCount > available / recordSize)
+			{
+				this->close();
+				return false;
+			}
+
+			const auto recordBytes = this->header->RecordCount * recordSize;
+
+			if(this->header->StringTableSize > available - recordBytes)
+			{
+				this->close();
+				return false;
+			}
+
+			this->records = this->file.getData() + sizeof(ArchiveBinaryHeader);
+			this->strings = this->file.getData() + sizeof(ArchiveBinaryHeader) + recordBytes;
+
+			return true;
+		}
+
+		void close()
+		{
+			this->file.close();
+			this->header = nullptr;
+			this->records = nullptr;
+			this->strings = nullptr;
+		}
+
+		bool isOpen() const
+		{
+			return this->header != nullptr;
+		}
+
+		size_t size() const
+		{
+			return (this->header != nullptr) ? static_cast<size_t>(this->header->RecordCount) : 0;
+		}
+
+		///
+		/// Copy a record out of the map.  Older, shorter records leave the fields they lack zeroed.
+		///
+		ArchiveBinaryRecord getRecord(size_t x) const
+		{
+			auto record = ArchiveBinaryRecord();
+			std::memcpy(&record, this->records + x * this->header->RecordSize, this->header->RecordSize);
+			return record;
+		}
+
+		///
+		/// Copy a record out of the map into an ArchiveEntry.
+		///
+		ArchiveEntry get(size_t x) const
+		{
+			const auto record = this->getRecord(x);
+
+			ArchiveEntry entry;
+			entry.GroupName = this->getString(record.GroupNameOffset, record.GroupNameLength);
+			entry.RunName = this->getString(record.RunNameOffset, record.RunNameLength);
+			entry.Parameters = this->getString(record.ParametersOffset, record.ParametersLength);
+			entry.BytesPerIteration = record.BytesPerIteration;
+			entry.ItemsPerIteration = record.ItemsPerIteration;
+			entry.ExperimentValue = record.ExperimentValue;
+			entry.ExperimentValueScale = record.ExperimentValueScale;
+			entry.FirstRanDate = record.FirstRanDate;
+			entry.TotalSamplesCollected = record.TotalSamplesCollected;
+			entry.Failure = (record.Failure != 0);
+			entry.AverageBaseline = record.AverageBaseline;
+			entry.MinBaseline = record.MinBaseline;
+			entry.MinBaseline_TimeSinceEpoch = record.MinBaseline_TimeSinceEpoch;
+			entry.MinStats = record.MinStats;
+			entry.MaxBaseline = record.MaxBaseline;
+			entry.MaxBaseline_TimeSinceEpoch = record.MaxBaseline_TimeSinceEpoch;
+			entry.MaxStats = record.MaxStats;
+			entry.CurrentBaseline = record.CurrentBaseline;
+			entry.CurrentBaseline_TimeSinceEpoch = record.CurrentBaseline_TimeSinceEpoch;
+			entry.CurrentStats = record.CurrentStats;
+			return entry;
+		}
+
+		///
+		/// The key of a record, without converting the rest of it.
+		///
+		ArchiveHistoryKey getKey(size_t x) const
+		{
+			const auto record = this->getRecord(x);
+
+			ArchiveHistoryKey key;
+			key.GroupName = this->getString(record.GroupNameOffset, record.GroupNameLength);
+			key.RunName = this->getString(record.RunNameOffset, record.RunNameLength);
+			key.ExperimentValue = record.ExperimentValue;
+			key.Parameters = this->getString(record.ParametersOffset, record.ParametersLength);
+			return key;
+		}
+
+		const char* getStringTable() const
+		{
+			return this->strings;
+		}
+
+		uint64_t getStringTableSize() const
+		{
+			return (this->header != nullptr) ? this->header->StringTableSize : 0;
+		}
+
+	private:
+		std::string getString(uint64_t offset, uint32_t length) const
+		{
+			if(offset > this->header->StringTableSize || length > this->header->StringTableSize - offset)
+			{
+				return std::string();
+			}
+
+			return std::string(this->strings + offset, length);
+		}
+
+		MappedFile file;
+		const ArchiveBinaryHeader* header{nullptr};
+		const char* records{nullptr};
+		const char* strings{nullptr};
+	};
+
+	///
+	/// Copy everything but the strings of an entry into a record.
+	///
+	void SetRecordValues(ArchiveBinaryRecord& record, const ArchiveEntry& entry)
+	{
+		record.BytesPerIteration = entry.BytesPerIteration;
+		record.ItemsPerIteration = entry.ItemsPerIteration;
+		record.ExperimentValue = entry.ExperimentValue;
+		record.ExperimentValueScale = entry.ExperimentValueScale;
+		record.FirstRanDate = entry.FirstRanDate;
+		record.TotalSamplesCollected = entry.TotalSamplesCollected;
+		record.Failure = entry.Failure ? 1 : 0;
+		record.AverageBaseline = entry.AverageBaseline;
+		record.MinBaseline = entry.MinBaseline;
+		record.MinBaseline_TimeSinceEpoch = entry.MinBaseline_TimeSinceEpoch;
+		record.MinStats = entry.MinStats;
+		record.MaxBaseline = entry.MaxBaseline;
+		record.MaxBaseline_TimeSinceEpoch = entry.MaxBaseline_TimeSinceEpoch;
+		record.MaxStats = entry.MaxStats;
+		record.CurrentBaseline = entry.CurrentBaseline;
+		record.CurrentBaseline_TimeSinceEpoch = entry.CurrentBaseline_TimeSinceEpoch;
+		record.CurrentStats = entry.CurrentStats;
+	}
+
+	///
+	/// \class ArchiveBinaryWriter
+	///
+	/// Assembles a binary archive in memory and writes it with a single call.
+	///
+	class ArchiveBinaryWriter
+	{
+	public:
+		///
+		/// Start from the string table of a mapped archive, so its records can be added unchanged.  Must be called before anything is added.
+		///
+		void setStringTable(const char* data, uint64_t size)
+		{
+			this->stringTable.assign(data, static_cast<size_t>(size));
+		}
+
+		///
+		/// Add a record whose strings are already in the string table.
+		///
+		void add(const ArchiveBinaryRecord& x)
+		{
+			this->records.push_back(x);
+		}
+
+		///
+		/// Add an entry, adding its strings to the string table.
+		///
+		void add(const ArchiveEntry& x)
+		{
+			// Value-initialization zeroes every field before it is filled in.
+			auto record = ArchiveBinaryRecord();
+			record.GroupNameOffset = this->addString(x.GroupName);
+			record.GroupNameLength = static_cast<uint32_t>(x.GroupName.size());
+			record.RunNameOffset = this->addString(x.RunName);
+			record.RunNameLength = static_cast<uint32_t>(x.RunName.size());
+			record.ParametersOffset = this->addString(x.Parameters);
+			record.ParametersLength = static_cast<uint32_t>(x.Parameters.size());
+			SetRecordValues(record, x);
+			this->records.push_back(record);
+		}
+
+		///
+		/// Write the archive to a temporary file and then replace the target with it, so the target is never left truncated.
+		///
+		/// \param beforeReplace Called after the temporary file is written, before the target is replaced.
+		///
+		bool write(const std::string& fileName, const std::function<void()>& beforeReplace = nullptr) const
+		{
+			ArchiveBinaryHeader header;
+			std::memset(&header, 0, sizeof(header));
+			std::memcpy(header.Magic, ArchiveBinaryMagic, sizeof(ArchiveBinaryMagic));
+			header.Version = ArchiveBinaryHeader::CurrentVersion;
+			header.ByteOrder = ArchiveBinaryHeader::ByteOrderMark;
+			header.HeaderSize = sizeof(ArchiveBinaryHeader);
+			header.RecordSize = sizeof(ArchiveBinaryRecord);
+			header.RecordCount = this->records.size();
+			header.StringTableSize = this->stringTable.size();
+
+			std::string buffer;
+			buffer.reserve(sizeof(header) + this->records.size() * sizeof(ArchiveBinaryRecord) + this->stringTable.size());
+			buffer.append(reinterpret_cast<const char*>(&header), sizeof(header));
+
+			if(this->records.empty() == false)
+			{
+				buffer.append(reinterpret_cast<const char*>(this->records.data()), this->records.size() * sizeof(ArchiveBinaryRecord));
+			}
+
+			buffer += this->stringTable;
+
+			const auto tempFileName = fileName + ".tmp";
+
+			std::ofstream os;
+			os.open(tempFileName.c_str(), std::fstream::out | std::fstream::binary | std::fstream::trunc);
+
+			if(os.is_open() == false)
+			{
+				return false;
+			}
+
+			os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+			os.close();
+
+			if(os.fail() == true)
+			{
+				std::remove(tempFileName.c_str());
+				return false;
+			}
+
+			if(beforeReplace != nullptr)
+			{
+				beforeReplace();
+			}
+
+			if(celero::impl::AtomicReplaceFile(tempFileName, fileName) == false)
+			{
+				std::remove(tempFileName.c_str());
+				return false;
+			}
+
+			return true;
+		}
+
+	private:
+		uint64_t addString(const std::string& x)
+		{
+			const auto found = this->stringOffsets.find(x);
+
+			if(found != std::end(this->stringOffsets))
+			{
+				return found->second;
+			}
+
+			const auto offset = static_cast<uint64_t>(this->stringTable.size());
+			this->stringTable += x;
+			this->stringOffsets[x] = offset;
+			return offset;
+		}
+
+		std::vector<ArchiveBinaryRecord> records;
+		std::string stringTable;
+		std::map<std::string, uint64_t> stringOffsets;
+	};
+
+	///
+	/// Write a set of entries as a binary archive.
+	///
+	bool WriteBinaryArchive(const std::string& fileName, const std::vector<ArchiveEntry>& entries)
+	{
+		ArchiveBinaryWriter writer;
+
+		for(const auto& entry : entries)
+		{
+			writer.add(entry);
+		}
+
+		return writer.write(fileName);
+	}
+
+	///
+	/// Write a set of entries as a CSV archive.
+	///
+	bool WriteCSVArchive(const std::string& fileName, const std::vector<ArchiveEntry>& entries)
+	{
+		// As with binary archives, a crash while writing must not leave the archive truncated.
+		const auto tempFileName = fileName + ".tmp";
+
+		std::ofstream os;
+		os.open(tempFileName.c_str(), std::fstream::out);
+
+		if(os.is_open() == false)
+		{
+			return false;
+		}
+
+		ArchiveEntry::WriteHeader(os);
+
+		for(auto& i : entries)
+		{
+			os << i;
+		}
+
+		os.close();
+
+		if(os.fail() == true || celero::impl::AtomicReplaceFile(tempFileName, fileName) == false)
+		{
+			std::remove(tempFileName.c_str());
+			return false;
+		}
+
+		return true;
+	}
+
+	///
+	/// Read all entries from a CSV archive.
+	///
+	void ReadCSVArchive(const std::string& fileName, std::vector<ArchiveEntry>& entries)
+	{
+		std::ifstream is;
+		is.open(fileName, std::fstream::in);
+
+		if((is.is_open() == true) && (is.good() == true) && (is.fail() == false))
+		{
+			// Throw away the header.
+			is.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+			// Read in existing results.
+			ArchiveEntry r;
+
+			while(is >> r)
+			{
+				if(r.GroupName.empty() == false)
+				{
+					entries.push_back(r);
+				}
+			}
+
+			// Close the file for reading.
+			is.close();
+		}
+	}
+
+	///
+	/// The key of an entry.
+	///
+	ArchiveHistoryKey GetKey(const ArchiveEntry& x)
+	{
+		ArchiveHistoryKey key;
+		key.GroupName = x.GroupName;
+		key.RunName = x.RunName;
+		key.ExperimentValue = x.ExperimentValue;
+		key.Parameters = x.Parameters;
+		return key;
+	}
+} // namespace
 
 ///
 /// \class Impl
@@ -210,33 +886,217 @@ public:
 
 	void readExistingResults()
 	{
-		// Read in existing results?
-		std::ifstream is;
-		is.open(this->fileName, std::fstream::in);
+		this->clearIndex();
 
-		if((is.is_open() == true) && (is.good() == true) && (is.fail() == false))
+		// Binary archives are only mapped here.  Records are looked up and updated in place; only updated records are copied out.
+		if(this->binaryView.open(this->fileName) == true)
 		{
-			// Throw away the header.
-			is.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+			this->format = Archive::Format::Binary;
+			return;
+		}
 
-			// Read in existing results.
-			ArchiveEntry r;
+		ReadCSVArchive(this->fileName, this->results);
+	}
 
-			while(is >> r)
+	///
+	/// The entry of the given key, or nullptr.  A record of the mapped archive is copied out the first time it is found.
+	///
+	ArchiveEntry* find(const ArchiveHistoryKey& key)
+	{
+		this->buildIndex();
+
+		const auto result = this->resultIndex.find(key);
+
+		if(result != std::end(this->resultIndex))
+		{
+			return &this->results[result->second];
+		}
+
+		const auto record = this->recordIndex.find(key);
+
+		if(record != std::end(this->recordIndex))
+		{
+			auto updated = this->updatedRecords.find(record->second);
+
+			if(updated == std::end(this->updatedRecords))
+			{
+				updated = this->updatedRecords.emplace(record->second, this->binaryView.get(record->second)).first;
+			}
+
+			return &updated->second;
+		}
+
+		return nullptr;
+	}
+
+	///
+	/// Append a new entry, keeping the index current.
+	///
+	void addResult(const ArchiveEntry& x)
+	{
+		this->results.push_back(x);
+
+		if(this->isIndexed == true)
+		{
+			this->resultIndex.emplace(GetKey(x), this->results.size() - 1);
+		}
+	}
+
+	///
+	/// Index the entries and mapped records by key, once, so that every lookup does not scan them all.
+	///
+	void buildIndex()
+	{
+		if(this->isIndexed == true)
+		{
+			return;
+		}
+
+		// The first of several entries with the same key is the one found, as with a scan.
+		for(size_t i = 0; i < this->results.size(); ++i)
+		{
+			this->resultIndex.emplace(GetKey(this->results[i]), i);
+		}
+
+		for(size_t i = 0; i < this->binaryView.size(); ++i)
+		{
+			if(this->binaryView.getRecord(i).GroupNameLength != 0)
+			{
+				this->recordIndex.emplace(this->binaryView.getKey(i), i);
+			}
+		}
+
+		this->isIndexed = true;
+	}
+
+	void clearIndex()
+	{
+		this->resultIndex.clear();
+		this->recordIndex.clear();
+		this->isIndexed = false;
+	}
+
+	///
+	/// Copy any records which are still only present in a mapped binary archive into the results vector and release the map.
+	///
+	void materialize()
+	{
+		if(this->binaryView.isOpen() == true)
+		{
+			const auto recordCount = this->binaryView.size();
+
+			std::vector<ArchiveEntry> entries;
+			entries.reserve(recordCount + this->results.size());
+
+			for(size_t i = 0; i < recordCount; ++i)
 			{
+				const auto updated = this->updatedRecords.find(i);
+				auto r = (updated != std::end(this->updatedRecords)) ? updated->second : this->binaryView.get(i);
+
 				if(r.GroupName.empty() == false)
 				{
-					this->results.push_back(r);
+					entries.push_back(r);
 				}
 			}
 
-			// Close the file for reading.
-			is.close();
+			entries.insert(std::end(entries), std::begin(this->results), std::end(this->results));
+
+			this->results = std::move(entries);
+			this->updatedRecords.clear();
+			this->binaryView.close();
+			this->clearIndex();
+		}
+	}
+
+	///
+	/// Write a mapped binary archive with its updated and new records, copying unchanged records and strings straight from the map.
+	///
+	bool saveBinaryView()
+	{
+		ArchiveBinaryWriter writer;
+		writer.setStringTable(this->binaryView.getStringTable(), this->binaryView.getStringTableSize());
+
+		for(size_t i = 0; i < this->binaryView.size(); ++i)
+		{
+			auto record = this->binaryView.getRecord(i);
+
+			if(record.GroupNameLength == 0)
+			{
+				continue;
+			}
+
+			const auto updated = this->updatedRecords.find(i);
+
+			if(updated != std::end(this->updatedRecords))
+			{
+				// The key, and so the strings, of an updated record never change.
+				SetRecordValues(record, updated->second);
+			}
+
+			writer.add(record);
+		}
+
+		for(const auto& r : this->results)
+		{
+			writer.add(r);
+		}
+
+		// The map must be released before the file is replaced, and is then reopened on whichever file is now in place.
+		auto replaced = false;
+		const auto written = writer.write(this->fileName, [this, &replaced]() {
+			this->binaryView.close();
+			replaced = true;
+		});
+
+		if(replaced == true)
+		{
+			this->binaryView.open(this->fileName);
+		}
+
+		if(written == true)
+		{
+			this->updatedRecords.clear();
+			this->results.clear();
+		}
+
+		// Record indices refer to the file which was mapped before.
+		this->clearIndex();
+
+		return written;
+	}
+
+	std::string getHistoryFileName() const
+	{
+		return this->fileName + ".history";
+	}
+
+	void readExistingHistory()
+	{
+		this->history.clear();
+
+		if(this->historyEnabled == true)
+		{
+			this->history.load(this->getHistoryFileName());
 		}
 	}
 
+	/// The entries of a CSV archive, or the entries added to a mapped binary archive.
 	std::vector<ArchiveEntry> results;
+
 	std::string fileName;
+	ArchiveBinaryView binaryView;
+
+	/// The records of the mapped binary archive updated since it was last saved, by record index.
+	std::map<size_t, ArchiveEntry> updatedRecords;
+
+	/// The position of each entry in results, and of each record of the mapped binary archive, by key.  Built on the first lookup.
+	std::map<ArchiveHistoryKey, size_t> resultIndex;
+	std::map<ArchiveHistoryKey, size_t> recordIndex;
+	bool isIndexed{false};
+	Archive::Format format{Archive::Format::CSV};
+	ArchiveHistory history;
+	std::string label;
+	bool historyEnabled{false};
 };
 
 Archive::Archive() : pimpl()
@@ -253,15 +1113,105 @@ Archive& Archive::Instance()
 	return singleton;
 }
 
+Archive::Format Archive::DetectFormat(const std::string& fileName)
+{
+	ArchiveBinaryView view;
+	return (view.open(fileName) == true) ? Archive::Format::Binary : Archive::Format::CSV;
+}
+
+bool Archive::Convert(const std::string& inputFile, const std::string& outputFile, Format outputFormat)
+{
+	std::vector<ArchiveEntry> entries;
+
+	{
+		ArchiveBinaryView view;
+
+		if(view.open(inputFile) == true)
+		{
+			entries.reserve(view.size());
+
+			for(size_t i = 0; i < view.size(); ++i)
+			{
+				entries.push_back(view.get(i));
+			}
+		}
+		else
+		{
+			std::ifstream is(inputFile);
+
+			if(is.is_open() == false)
+			{
+				std::cerr << "ERROR: Celero could not open archive file: \"" << inputFile << "\"." << std::endl;
+				return false;
+			}
+
+			is.close();
+			ReadCSVArchive(inputFile, entries);
+		}
+	}
+
+	const auto written = (outputFormat == Archive::Format::Binary) ? WriteBinaryArchive(outputFile, entries) : WriteCSVArchive(outputFile, entries);
+
+	if(written == false)
+	{
+		std::cerr << "ERROR: Celero could not open archive output file: \"" << outputFile << "\"." << std::endl;
+	}
+
+	return written;
+}
+
 void Archive::setFileName(const std::string& x)
 {
 	if(x.empty() == false)
 	{
+		this->pimpl->materialize();
 		this->pimpl->fileName = x;
 		this->pimpl->readExistingResults();
+		this->pimpl->readExistingHistory();
 	}
 }
 
+void Archive::setFormat(Format x)
+{
+	this->pimpl->format = x;
+}
+
+Archive::Format Archive::getFormat() const
+{
+	return this->pimpl->format;
+}
+
+void Archive::setHistoryEnabled(bool x)
+{
+	this->pimpl->historyEnabled = x;
+}
+
+bool Archive::getHistoryEnabled() const
+{
+	return this->pimpl->historyEnabled;
+}
+
+void Archive::setLabel(const std::string& x)
+{
+	this->pimpl->label = x;
+}
+
+const ArchiveHistory& Archive::getHistory() const
+{
+	return this->pimpl->history;
+}
+
+std::vector<ArchiveHistoryPoint> Archive::getHistory(const std::string& groupName, const std::string& runName, int64_t experimentValue,
+													 const std::string& parameters) const
+{
+	ArchiveHistoryKey key;
+	key.GroupName = groupName;
+	key.RunName = runName;
+	key.ExperimentValue = experimentValue;
+	key.Parameters = parameters;
+	return this->pimpl->history.get(key);
+}
+
 void Archive::add(std::shared_ptr<celero::ExperimentResult> x)
 {
 	if(x == nullptr)
@@ -269,12 +1219,46 @@ void Archive::add(std::shared_ptr<celero::ExperimentResult> x)
 		return;
 	}
 
-	const auto found = std::find_if(std::begin(this->pimpl->results), std::end(this->pimpl->results), [x](const ArchiveEntry& r) -> bool {
-		return (r.GroupName == x->getExperiment()->getBenchmark()->getName()) && (r.RunName == x->getExperiment()->getName())
-			   && (r.ExperimentValue == x->getProblemSpaceValue());
-	});
+	if((this->pimpl->historyEnabled == true) && (x->getFailure() == false) && (x->getExperiment() != nullptr))
+	{
+		ArchiveHistoryKey key;
+		key.GroupName = x->getExperiment()->getBenchmark()->getName();
+		key.RunName = x->getExperiment()->getName();
+		key.ExperimentValue = x->getProblemSpaceValue();
+		key.Parameters = x->getProblemSpaceParameters();
+
+		const auto& stats = x->getTimeStatistics();
+
+		ArchiveHistoryPoint point;
+		point.Timestamp = this->pimpl->now();
+		point.Label = this->pimpl->label;
+		point.Samples = stats.getSize();
+		point.Baseline = x->getBaselineMeasurement();
+		point.UsPerCall = x->getUsPerCall();
+		point.Mean = stats.getMean();
+		point.StandardDeviation = stats.getStandardDeviation();
+		point.Min = stats.getMin();
+		point.Max = stats.getMax();
+
+		this->pimpl->history.add(key, point);
+	}
+
+	const auto parameters = x->getProblemSpaceParameters();
+	const auto experiment = x->getExperiment();
+
+	ArchiveEntry* found = nullptr;
+
+	if(experiment != nullptr)
+	{
+		ArchiveHistoryKey key;
+		key.GroupName = experiment->getBenchmark()->getName();
+		key.RunName = experiment->getName();
+		key.ExperimentValue = x->getProblemSpaceValue();
+		key.Parameters = parameters;
+		found = this->pimpl->find(key);
+	}
 
-	if(found != std::end(this->pimpl->results))
+	if(found != nullptr)
 	{
 		if(x->getFailure() == true)
 		{
@@ -284,6 +1268,8 @@ void Archive::add(std::shared_ptr<celero::ExperimentResult> x)
 		found->CurrentBaseline = x->getBaselineMeasurement();
 		found->CurrentBaseline_TimeSinceEpoch = this->pimpl->now();
 		found->CurrentStats = x->getTimeStatistics();
+		found->BytesPerIteration = x->getBytesPerIteration();
+		found->ItemsPerIteration = x->getItemsPerIteration();
 
 		if(found->Failure || found->CurrentBaseline <= found->MinBaseline)
 		{
@@ -316,8 +1302,6 @@ void Archive::add(std::shared_ptr<celero::ExperimentResult> x)
 	{
 		ArchiveEntry r;
 
-		const auto experiment = x->getExperiment();
-
 		if(experiment != nullptr)
 		{
 			r.GroupName = experiment->getBenchmark()->getName();
@@ -327,6 +1311,9 @@ void Archive::add(std::shared_ptr<celero::ExperimentResult> x)
 			r.AverageBaseline = x->getBaselineMeasurement();
 			r.ExperimentValue = x->getProblemSpaceValue();
 			r.ExperimentValueScale = x->getProblemSpaceValueScale();
+			r.Parameters = parameters;
+			r.BytesPerIteration = x->getBytesPerIteration();
+			r.ItemsPerIteration = x->getItemsPerIteration();
 			r.TotalSamplesCollected = x->getFailure() ? 0 : 1;
 
 			r.CurrentBaseline = x->getBaselineMeasurement();
@@ -341,37 +1328,37 @@ void Archive::add(std::shared_ptr<celero::ExperimentResult> x)
 			r.MinBaseline_TimeSinceEpoch = r.FirstRanDate;
 			r.MinStats = x->getTimeStatistics();
 
-			this->pimpl->results.push_back(r);
+			this->pimpl->addResult(r);
 		}
 	}
-
-	this->save();
 }
 
 void Archive::save()
 {
 	if(this->pimpl->fileName.empty() == false)
 	{
-		// Get ready to write out new results.
-		// We will write all known results every time, replacing file contents.
-		std::ofstream os;
-		os.open(this->pimpl->fileName.c_str(), std::fstream::out);
+		// Write all known results, replacing the file contents.
+		auto written = false;
 
-		if(os.is_open() == true)
+		if(this->pimpl->format == Archive::Format::Binary && this->pimpl->binaryView.isOpen() == true)
 		{
-			ArchiveEntry::WriteHeader(os);
-
-			for(auto& i : this->pimpl->results)
-			{
-				os << i;
-			}
-
-			os.flush();
-			os.close();
+			written = this->pimpl->saveBinaryView();
 		}
 		else
+		{
+			this->pimpl->materialize();
+			written = (this->pimpl->format == Archive::Format::Binary) ? WriteBinaryArchive(this->pimpl->fileName, this->pimpl->results)
+																	   : WriteCSVArchive(this->pimpl->fileName, this->pimpl->results);
+		}
+
+		if(written == false)
 		{
 			std::cerr << "ERROR: Celero could not open result output file: \"" << this->pimpl->fileName << "\"." << std::endl;
 		}
+
+		if(this->pimpl->historyEnabled == true)
+		{
+			this->pimpl->history.save(this->pimpl->getHistoryFileName());
+		}
 	}
 }
@@ -0,0 +1,617 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/ArchiveHistory.h>
+#include <celero/PimplImpl.h>
+#include <celero/TestFixture.h>
+#include <celero/Utilities.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <tuple>
+
+using namespace celero;
+
+namespace
+{
+	///
+	/// \struct ArchiveHistoryHeader
+	///
+	/// A history file is laid out as this header, followed by KeyCount ArchiveHistoryKeyRecords, LabelCount ArchiveHistoryLabelRecords, one
+	/// array of RowCount values per column (in the order they are declared in ArchiveHistory::Impl), and finally a string table of
+	/// StringTableSize bytes.  All values are stored in the native byte order of the machine that wrote the file.
+	///
+	/// Version 2 added the problem space parameters to each key record.  Version 1 files are still read.
+	///
+	struct ArchiveHistoryHeader
+	{
+		static constexpr uint32_t CurrentVersion{2};
+		static constexpr uint32_t ByteOrderMark{0x01020304};
+
+		char Magic[8];
+		uint32_t Version;
+		uint32_t ByteOrder;
+		uint64_t RowCount;
+		uint64_t KeyCount;
+		uint64_t LabelCount;
+		uint64_t StringTableSize;
+	};
+
+	struct ArchiveHistoryKeyRecordV1
+	{
+		uint64_t GroupNameOffset;
+		uint64_t RunNameOffset;
+		uint32_t GroupNameLength;
+		uint32_t RunNameLength;
+		int64_t ExperimentValue;
+	};
+
+	struct ArchiveHistoryKeyRecord
+	{
+		uint64_t GroupNameOffset;
+		uint64_t RunNameOffset;
+		uint32_t GroupNameLength;
+		uint32_t RunNameLength;
+		int64_t ExperimentValue;
+		uint64_t ParametersOffset;
+		uint32_t ParametersLength;
+		uint32_t Reserved;
+	};
+
+	struct ArchiveHistoryLabelRecord
+	{
+		uint64_t Offset;
+		uint64_t Length;
+	};
+
+	constexpr char ArchiveHistoryMagic[8] = {'C', 'E', 'L', 'E', 'R', 'O', 'H', 'S'};
+} // namespace
+
+bool ArchiveHistoryKey::operator==(const ArchiveHistoryKey& other) const
+{
+	return (this->GroupName == other.GroupName) && (this->RunName == other.RunName) && (this->ExperimentValue == other.ExperimentValue)
+		   && (this->Parameters == other.Parameters);
+}
+
+bool ArchiveHistoryKey::operator<(const ArchiveHistoryKey& other) const
+{
+	return std::tie(this->GroupName, this->RunName, this->ExperimentValue, this->Parameters)
+		   < std::tie(other.GroupName, other.RunName, other.ExperimentValue, other.Parameters);
+}
+
+///
+/// \class Impl
+///
+class celero::ArchiveHistory::Impl
+{
+public:
+	uint32_t getKeyIndex(const ArchiveHistoryKey& x)
+	{
+		const auto found = this->keyIndices.find(x);
+
+		if(found != std::end(this->keyIndices))
+		{
+			return found->second;
+		}
+
+		const auto index = static_cast<uint32_t>(this->keys.size());
+		this->keys.push_back(x);
+		this->keyIndices[x] = index;
+		this->keyRows.emplace_back();
+		return index;
+	}
+
+	uint32_t getLabelIndex(const std::string& x)
+	{
+		const auto found = this->labelIndices.find(x);
+
+		if(found != std::end(this->labelIndices))
+		{
+			return found->second;
+		}
+
+		const auto index = static_cast<uint32_t>(this->labels.size());
+		this->labels.push_back(x);
+		this->labelIndices[x] = index;
+		return index;
+	}
+
+	void clear()
+	{
+		this->keys.clear();
+		this->keyIndices.clear();
+		this->labels.clear();
+		this->labelIndices.clear();
+		this->keyIndex.clear();
+		this->keyRows.clear();
+		this->labelIndex.clear();
+		this->timestamp.clear();
+		this->samples.clear();
+		this->baseline.clear();
+		this->usPerCall.clear();
+		this->mean.clear();
+		this->standardDeviation.clear();
+		this->min.clear();
+		this->max.clear();
+	}
+
+	std::vector<ArchiveHistoryKey> keys;
+	std::map<ArchiveHistoryKey, uint32_t> keyIndices;
+
+	std::vector<std::string> labels;
+	std::map<std::string, uint32_t> labelIndices;
+
+	/// The rows of each key, in the order they were added, so a series is read without scanning every row.
+	std::vector<std::vector<size_t>> keyRows;
+
+	// One entry per point in each column.
+	std::vector<uint32_t> keyIndex;
+	std::vector<uint32_t> labelIndex;
+	std::vector<uint64_t> timestamp;
+	std::vector<uint64_t> samples;
+	std::vector<double> baseline;
+	std::vector<double> usPerCall;
+	std::vector<double> mean;
+	std::vector<double> standardDeviation;
+	std::vector<int64_t> min;
+	std::vector<int64_t> max;
+};
+
+namespace
+{
+	///
+	/// The number of bytes between the read position and the end of a stream.
+	///
+	uint64_t RemainingBytes(std::istream& is)
+	{
+		const auto position = is.tellg();
+		is.seekg(0, std::ios::end);
+		const auto end = is.tellg();
+		is.seekg(position);
+
+		return (position >= 0 && end >= position) ? static_cast<uint64_t>(end - position) : 0;
+	}
+
+	///
+	/// Read a whole column from a stream with a single bulk copy.
+	///
+	/// The count comes from the file, so it is checked against the bytes left in the stream before anything is allocated.
+	///
+	template <typename T>
+	bool ReadColumn(std::istream& is, std::vector<T>& x, uint64_t count)
+	{
+		if(count > RemainingBytes(is) / sizeof(T))
+		{
+			return false;
+		}
+
+		x.resize(static_cast<size_t>(count));
+
+		if(count > 0)
+		{
+			is.read(reinterpret_cast<char*>(x.data()), static_cast<std::streamsize>(count * sizeof(T)));
+		}
+
+		return is.good();
+	}
+
+	///
+	/// Write a whole column to a string buffer with a single bulk copy.
+	///
+	template <typename T>
+	void WriteColumn(std::string& buffer, const std::vector<T>& x)
+	{
+		if(x.empty() == false)
+		{
+			buffer.append(reinterpret_cast<const char*>(x.data()), x.size() * sizeof(T));
+		}
+	}
+} // namespace
+
+ArchiveHistory::ArchiveHistory() : pimpl()
+{
+}
+
+ArchiveHistory::~ArchiveHistory()
+{
+}
+
+bool ArchiveHistory::load(const std::string& fileName)
+{
+	this->pimpl->clear();
+
+	std::ifstream is;
+	is.open(fileName, std::fstream::in | std::fstream::binary);
+
+	if(is.is_open() == false)
+	{
+		return false;
+	}
+
+	ArchiveHistoryHeader header;
+	is.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+	if((is.good() == false) || (std::memcmp(header.Magic, ArchiveHistoryMagic, sizeof(ArchiveHistoryMagic)) != 0)
+	   || (header.Version < 1 || header.Version > ArchiveHistoryHeader::CurrentVersion) || (header.ByteOrder != ArchiveHistoryHeader::ByteOrderMark))
+	{
+		return false;
+	}
+
+	std::vector<ArchiveHistoryKeyRecord> keyRecords;
+	std::vector<ArchiveHistoryLabelRecord> labelRecords;
+	std::string stringTable;
+
+	const auto rows = header.RowCount;
+	auto ok = true;
+
+	if(header.Version == 1)
+	{
+		// Version 1 keys have no parameters.
+		std::vector<ArchiveHistoryKeyRecordV1> oldKeyRecords;
+		ok = ReadColumn(is, oldKeyRecords, header.KeyCount);
+
+		for(const auto& i : oldKeyRecords)
+		{
+			ArchiveHistoryKeyRecord record;
+			std::memset(&record, 0, sizeof(record));
+			record.GroupNameOffset = i.GroupNameOffset;
+			record.RunNameOffset = i.RunNameOffset;
+			record.GroupNameLength = i.GroupNameLength;
+			record.RunNameLength = i.RunNameLength;
+			record.ExperimentValue = i.ExperimentValue;
+			keyRecords.push_back(record);
+		}
+	}
+	else
+	{
+		ok = ReadColumn(is, keyRecords, header.KeyCount);
+	}
+
+	ok = ok && ReadColumn(is, labelRecords, header.LabelCount);
+	ok = ok && ReadColumn(is, this->pimpl->keyIndex, rows);
+	ok = ok && ReadColumn(is, this->pimpl->labelIndex, rows);
+	ok = ok && ReadColumn(is, this->pimpl->timestamp, rows);
+	ok = ok && ReadColumn(is, this->pimpl->samples, rows);
+	ok = ok && ReadColumn(is, this->pimpl->baseline, rows);
+	ok = ok && ReadColumn(is, this->pimpl->usPerCall, rows);
+	ok = ok && ReadColumn(is, this->pimpl->mean, rows);
+	ok = ok && ReadColumn(is, this->pimpl->standardDeviation, rows);
+	ok = ok && ReadColumn(is, this->pimpl->min, rows);
+	ok = ok && ReadColumn(is, this->pimpl->max, rows);
+
+	ok = ok && (header.StringTableSize <= RemainingBytes(is));
+
+	if(ok == true)
+	{
+		stringTable.resize(static_cast<size_t>(header.StringTableSize));
+
+		if(stringTable.empty() == false)
+		{
+			is.read(&stringTable[0], static_cast<std::streamsize>(stringTable.size()));
+			ok = (is.fail() == false);
+		}
+	}
+
+	auto getString = [&stringTable, &ok](uint64_t offset, uint64_t length) -> std::string {
+		if(offset > stringTable.size() || length > stringTable.size() - offset)
+		{
+			ok = false;
+			return std::string();
+		}
+
+		return stringTable.substr(static_cast<size_t>(offset), static_cast<size_t>(length));
+	};
+
+	for(const auto& i : keyRecords)
+	{
+		ArchiveHistoryKey key;
+		key.GroupName = getString(i.GroupNameOffset, i.GroupNameLength);
+		key.RunName = getString(i.RunNameOffset, i.RunNameLength);
+		key.ExperimentValue = i.ExperimentValue;
+		key.Parameters = getString(i.ParametersOffset, i.ParametersLength);
+		this->pimpl->getKeyIndex(key);
+	}
+
+	for(const auto& i : labelRecords)
+	{
+		this->pimpl->getLabelIndex(getString(i.Offset, i.Length));
+	}
+
+	// Every row must refer to a valid key and label.
+	ok = ok && std::all_of(std::begin(this->pimpl->keyIndex), std::end(this->pimpl->keyIndex),
+						   [this](uint32_t x) { return x < this->pimpl->keys.size(); });
+	ok = ok && std::all_of(std::begin(this->pimpl->labelIndex), std::end(this->pimpl->labelIndex),
+						   [this](uint32_t x) { return x < this->pimpl->labels.size(); });
+
+	if(ok == true)
+	{
+		for(size_t i = 0; i < this->pimpl->keyIndex.size(); ++i)
+		{
+			this->pimpl->keyRows[this->pimpl->keyIndex[i]].push_back(i);
+		}
+	}
+	else
+	{
+		std::cerr << "ERROR: Celero could not read archive history file: \"" << fileName << "\"." << std::endl;
+		this->pimpl->clear();
+	}
+
+	return ok;
+}
+
+bool ArchiveHistory::save(const std::string& fileName) const
+{
+	std::string stringTable;
+	std::vector<ArchiveHistoryKeyRecord> keyRecords;
+	std::vector<ArchiveHistoryLabelRecord> labelRecords;
+
+	for(const auto& i : this->pimpl->keys)
+	{
+		ArchiveHistoryKeyRecord record;
+		std::memset(&record, 0, sizeof(record));
+		record.GroupNameOffset = stringTable.size();
+		record.GroupNameLength = static_cast<uint32_t>(i.GroupName.size());
+		stringTable += i.GroupName;
+		record.RunNameOffset = stringTable.size();
+		record.RunNameLength = static_cast<uint32_t>(i.RunName.size());
+		stringTable += i.RunName;
+		record.ExperimentValue = i.ExperimentValue;
+		record.ParametersOffset = stringTable.size();
+		record.ParametersLength = static_cast<uint32_t>(i.Parameters.size());
+		stringTable += i.Parameters;
+		keyRecords.push_back(record);
+	}
+
+	for(const auto& i : this->pimpl->labels)
+	{
+		ArchiveHistoryLabelRecord record;
+		record.Offset = stringTable.size();
+		record.Length = i.size();
+		stringTable += i;
+		labelRecords.push_back(record);
+	}
+
+	ArchiveHistoryHeader header;
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.Magic, ArchiveHistoryMagic, sizeof(ArchiveHistoryMagic));
+	header.Version = ArchiveHistoryHeader::CurrentVersion;
+	header.ByteOrder = ArchiveHistoryHeader::ByteOrderMark;
+	header.RowCount = this->pimpl->keyIndex.size();
+	header.KeyCount = keyRecords.size();
+	header.LabelCount = labelRecords.size();
+	header.StringTableSize = stringTable.size();
+
+	std::string buffer;
+	buffer.append(reinterpret_cast<const char*>(&header), sizeof(header));
+	WriteColumn(buffer, keyRecords);
+	WriteColumn(buffer, labelRecords);
+	WriteColumn(buffer, this->pimpl->keyIndex);
+	WriteColumn(buffer, this->pimpl->labelIndex);
+	WriteColumn(buffer, this->pimpl->timestamp);
+	WriteColumn(buffer, this->pimpl->samples);
+	WriteColumn(buffer, this->pimpl->baseline);
+	WriteColumn(buffer, this->pimpl->usPerCall);
+	WriteColumn(buffer, this->pimpl->mean);
+	WriteColumn(buffer, this->pimpl->standardDeviation);
+	WriteColumn(buffer, this->pimpl->min);
+	WriteColumn(buffer, this->pimpl->max);
+	buffer += stringTable;
+
+	// Write a temporary file and swap it in, so an interrupted save leaves the previous history intact.
+	const auto tempFileName = fileName + ".tmp";
+
+	std::ofstream os;
+	os.open(tempFileName.c_str(), std::fstream::out | std::fstream::binary | std::fstream::trunc);
+
+	if(os.is_open() == false)
+	{
+		std::cerr << "ERROR: Celero could not open archive history file: \"" << tempFileName << "\"." << std::endl;
+		return false;
+	}
+
+	os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	os.close();
+
+	if((os.fail() == true) || (celero::impl::AtomicReplaceFile(tempFileName, fileName) == false))
+	{
+		std::cerr << "ERROR: Celero could not write archive history file: \"" << fileName << "\"." << std::endl;
+		std::remove(tempFileName.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+void ArchiveHistory::clear()
+{
+	this->pimpl->clear();
+}
+
+void ArchiveHistory::add(const ArchiveHistoryKey& key, const ArchiveHistoryPoint& point)
+{
+	const auto index = this->pimpl->getKeyIndex(key);
+	this->pimpl->keyRows[index].push_back(this->pimpl->keyIndex.size());
+	this->pimpl->keyIndex.push_back(index);
+	this->pimpl->labelIndex.push_back(this->pimpl->getLabelIndex(point.Label));
+	this->pimpl->timestamp.push_back(point.Timestamp);
+	this->pimpl->samples.push_back(point.Samples);
+	this->pimpl->baseline.push_back(point.Baseline);
+	this->pimpl->usPerCall.push_back(point.UsPerCall);
+	this->pimpl->mean.push_back(point.Mean);
+	this->pimpl->standardDeviation.push_back(point.StandardDeviation);
+	this->pimpl->min.push_back(point.Min);
+	this->pimpl->max.push_back(point.Max);
+}
+
+size_t ArchiveHistory::size() const
+{
+	return this->pimpl->keyIndex.size();
+}
+
+std::vector<ArchiveHistoryKey> ArchiveHistory::getKeys() const
+{
+	std::vector<ArchiveHistoryKey> keys;
+	keys.reserve(this->pimpl->keyIndices.size());
+
+	// Keys are only ever created alongside a point, and the map is already sorted.
+	for(const auto& i : this->pimpl->keyIndices)
+	{
+		keys.push_back(i.first);
+	}
+
+	return keys;
+}
+
+std::vector<ArchiveHistoryPoint> ArchiveHistory::get(const ArchiveHistoryKey& key) const
+{
+	std::vector<ArchiveHistoryPoint> points;
+
+	const auto found = this->pimpl->keyIndices.find(key);
+
+	if(found == std::end(this->pimpl->keyIndices))
+	{
+		return points;
+	}
+
+	const auto& rows = this->pimpl->keyRows[found->second];
+	points.reserve(rows.size());
+
+	for(const auto i : rows)
+	{
+		ArchiveHistoryPoint point;
+		point.Timestamp = this->pimpl->timestamp[i];
+		point.Label = this->pimpl->labels[this->pimpl->labelIndex[i]];
+		point.Samples = this->pimpl->samples[i];
+		point.Baseline = this->pimpl->baseline[i];
+		point.UsPerCall = this->pimpl->usPerCall[i];
+		point.Mean = this->pimpl->mean[i];
+		point.StandardDeviation = this->pimpl->standardDeviation[i];
+		point.Min = this->pimpl->min[i];
+		point.Max = this->pimpl->max[i];
+		points.push_back(point);
+	}
+
+	return points;
+}
+
+double ArchiveHistory::TrendSlope(const std::vector<ArchiveHistoryPoint>& x)
+{
+	const auto n = static_cast<double>(x.size());
+
+	if(x.size() < 2)
+	{
+		return 0.0;
+	}
+
+	auto sumX = 0.0;
+	auto sumY = 0.0;
+	auto sumXY = 0.0;
+	auto sumXX = 0.0;
+
+	for(size_t i = 0; i < x.size(); ++i)
+	{
+		const auto xi = static_cast<double>(i);
+		const auto yi = x[i].UsPerCall;
+		sumX += xi;
+		sumY += yi;
+		sumXY += xi * yi;
+		sumXX += xi * xi;
+	}
+
+	const auto denominator = n * sumXX - sumX * sumX;
+	const auto mean = sumY / n;
+
+	if(denominator == 0.0 || mean == 0.0)
+	{
+		return 0.0;
+	}
+
+	const auto slope = (n * sumXY - sumX * sumY) / denominator;
+	return 100.0 * slope / mean;
+}
+
+std::string ArchiveHistory::Sparkline(const std::vector<ArchiveHistoryPoint>& x)
+{
+	static const char* const Bars[] = {"\xE2\x96\x81", "\xE2\x96\x82", "\xE2\x96\x83", "\xE2\x96\x84",
+									   "\xE2\x96\x85", "\xE2\x96\x86", "\xE2\x96\x87", "\xE2\x96\x88"};
+	constexpr size_t BarCount = sizeof(Bars) / sizeof(Bars[0]);
+
+	std::string line;
+
+	if(x.empty() == true)
+	{
+		return line;
+	}
+
+	const auto minmax = std::minmax_element(std::begin(x), std::end(x),
+											[](const ArchiveHistoryPoint& a, const ArchiveHistoryPoint& b) { return a.UsPerCall < b.UsPerCall; });
+	const auto low = minmax.first->UsPerCall;
+	const auto range = minmax.second->UsPerCall - low;
+
+	for(const auto& i : x)
+	{
+		auto bar = size_t(0);
+
+		if(range > 0.0)
+		{
+			bar = static_cast<size_t>((i.UsPerCall - low) / range * static_cast<double>(BarCount - 1) + 0.5);
+		}
+
+		line += Bars[std::min(bar, BarCount - 1)];
+	}
+
+	return line;
+}
+
+void ArchiveHistory::printTrends(std::ostream& os) const
+{
+	for(const auto& key : this->getKeys())
+	{
+		const auto points = this->get(key);
+
+		os << key.GroupName << "." << key.RunName;
+
+		if(key.Parameters.empty() == false)
+		{
+			os << "/" << key.Parameters;
+		}
+		else if(key.ExperimentValue != static_cast<int64_t>(TestFixture::Constants::NoProblemSpaceValue))
+		{
+			os << "/" << key.ExperimentValue;
+		}
+
+		std::ostringstream line;
+		line << " " << ArchiveHistory::Sparkline(points) << " " << std::showpos << std::fixed << std::setprecision(2) << ArchiveHistory::TrendSlope(points)
+			 << std::noshowpos << "%/run over " << points.size() << " runs, latest " << std::setprecision(5) << points.back().UsPerCall
+			 << " us/Iteration";
+		os << line.str();
+
+		if(points.back().Label.empty() == false)
+		{
+			os << " (" << points.back().Label << ")";
+		}
+
+		os << "\n";
+	}
+}
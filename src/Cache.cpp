@@ -0,0 +1,198 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Cache.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <sys/sysctl.h>
+#include <sys/types.h>
+#else
+#include <fstream>
+#include <string>
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define CELERO_HAS_CLFLUSH 1
+#else
+#define CELERO_HAS_CLFLUSH 0
+#endif
+
+using namespace celero;
+
+namespace
+{
+	std::atomic<cache::Mode> CacheMode{cache::Mode::None};
+	std::atomic<cache::Method> CacheMethod{cache::Method::Flush};
+
+	constexpr int64_t DefaultLastLevelCacheSize{32 * 1024 * 1024};
+	constexpr size_t CacheLineSize{64};
+
+	/// Keeps the reads of Flush from being optimized away.
+	volatile unsigned char FlushSink{0};
+
+	int64_t DetectLastLevelCacheSize()
+	{
+		auto size = int64_t(0);
+
+#ifdef _WIN32
+		DWORD length = 0;
+		GetLogicalProcessorInformation(nullptr, &length);
+
+		std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+
+		if(info.empty() == false && GetLogicalProcessorInformation(info.data(), &length) == TRUE)
+		{
+			for(const auto& i : info)
+			{
+				if(i.Relationship == RelationCache && i.Cache.Type != CacheInstruction)
+				{
+					size = std::max(size, static_cast<int64_t>(i.Cache.Size));
+				}
+			}
+		}
+#elif defined(__APPLE__)
+		for(const auto name : {"hw.l3cachesize", "hw.l2cachesize"})
+		{
+			int64_t value = 0;
+			size_t length = sizeof(value);
+
+			if(sysctlbyname(name, &value, &length, nullptr, 0) == 0)
+			{
+				size = std::max(size, value);
+			}
+		}
+#else
+		// Every cache of cpu0 is listed as index0, index1, ... with its type and a size such as "32K" or "8M".
+		for(auto i = 0;; ++i)
+		{
+			const auto path = std::string("/sys/devices/system/cpu/cpu0/cache/index") + std::to_string(i) + "/";
+			std::ifstream typeFile(path + "type");
+			std::ifstream sizeFile(path + "size");
+
+			if(typeFile.is_open() == false || sizeFile.is_open() == false)
+			{
+				break;
+			}
+
+			std::string type;
+			int64_t value = 0;
+			char unit = 0;
+
+			typeFile >> type;
+			sizeFile >> value >> unit;
+
+			if(type == "Instruction")
+			{
+				continue;
+			}
+
+			if(unit == 'K')
+			{
+				value *= 1024;
+			}
+			else if(unit == 'M')
+			{
+				value *= 1024 * 1024;
+			}
+			else if(unit == 'G')
+			{
+				value *= 1024 * 1024 * 1024;
+			}
+
+			size = std::max(size, value);
+		}
+#endif
+
+		return (size > 0) ? size : DefaultLastLevelCacheSize;
+	}
+} // namespace
+
+void cache::SetMode(Mode x)
+{
+	CacheMode = x;
+}
+
+cache::Mode cache::GetMode()
+{
+	return CacheMode;
+}
+
+void cache::SetMethod(Method x)
+{
+	CacheMethod = x;
+}
+
+cache::Method cache::GetMethod()
+{
+	return CacheMethod;
+}
+
+int64_t cache::GetLastLevelCacheSize()
+{
+	static const auto size = DetectLastLevelCacheSize();
+	return size;
+}
+
+void cache::Flush()
+{
+	// Allocated and touched once, so that flushing does not itself page fault.
+	static std::vector<unsigned char> buffer(static_cast<size_t>(cache::GetLastLevelCacheSize()) * 2, 1);
+
+	auto sum = static_cast<unsigned char>(0);
+
+	// Touch every line for writing, then read it back, so both clean and dirty lines of the code under test are replaced.
+	for(size_t i = 0; i < buffer.size(); i += CacheLineSize)
+	{
+		buffer[i]++;
+	}
+
+	for(size_t i = 0; i < buffer.size(); i += CacheLineSize)
+	{
+		sum ^= buffer[i];
+	}
+
+	FlushSink = sum;
+}
+
+bool cache::Evict(const void* data, size_t size)
+{
+#if CELERO_HAS_CLFLUSH
+	const auto begin = reinterpret_cast<uintptr_t>(data) & ~(uintptr_t(CacheLineSize) - 1);
+	const auto end = reinterpret_cast<uintptr_t>(data) + size;
+
+	for(auto line = begin; line < end; line += CacheLineSize)
+	{
+		_mm_clflush(reinterpret_cast<const void*>(line));
+	}
+
+	// Make sure the lines are gone before the timed region starts.
+	_mm_mfence();
+	return true;
+#else
+	(void)data;
+	(void)size;
+	return false;
+#endif
+}
@@ -18,6 +18,7 @@
 
 #include <celero/Callbacks.h>
 #include <algorithm>
+#include <atomic>
 #include <mutex>
 #include <vector>
 
@@ -27,6 +28,13 @@ std::vector<std::function<void(std::shared_ptr<Experiment>)>> ExperimentFunction
 std::mutex ExperimentFunctionsMutex;
 std::vector<std::function<void(std::shared_ptr<celero::ExperimentResult>)>> ExperimentResultFunctions;
 std::mutex ExperimentResultFunctionsMutex;
+std::vector<std::function<void(std::shared_ptr<celero::ExperimentResult>)>> ExperimentResultStartFunctions;
+std::mutex ExperimentResultStartFunctionsMutex;
+std::vector<std::function<void(std::shared_ptr<celero::ExperimentResult>, uint64_t)>> SampleFunctions;
+std::mutex SampleFunctionsMutex;
+
+// Samples complete very often, so skip taking the lock when nothing is listening.
+std::atomic<bool> HasSampleFunctions{false};
 
 void celero::impl::ExperimentComplete(std::shared_ptr<Experiment> x)
 {
@@ -48,6 +56,31 @@ void celero::impl::ExperimentResultComplete(std::shared_ptr<celero::ExperimentRe
 	}
 }
 
+void celero::impl::ExperimentResultStart(std::shared_ptr<celero::ExperimentResult> x)
+{
+	std::lock_guard<std::mutex> lock(ExperimentResultStartFunctionsMutex);
+
+	for(auto& i : ExperimentResultStartFunctions)
+	{
+		i(x);
+	}
+}
+
+void celero::impl::SampleComplete(std::shared_ptr<celero::ExperimentResult> x, uint64_t sampleTime)
+{
+	if(HasSampleFunctions == false)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(SampleFunctionsMutex);
+
+	for(auto& i : SampleFunctions)
+	{
+		i(x, sampleTime);
+	}
+}
+
 void celero::AddExperimentCompleteFunction(std::function<void(std::shared_ptr<Experiment>)> x)
 {
 	std::lock_guard<std::mutex> lock(ExperimentFunctionsMutex);
@@ -59,3 +92,16 @@ void celero::AddExperimentResultCompleteFunction(std::function<void(std::shared_
 	std::lock_guard<std::mutex> lock(ExperimentResultFunctionsMutex);
 	ExperimentResultFunctions.push_back(x);
 }
+
+void celero::AddExperimentResultStartFunction(std::function<void(std::shared_ptr<celero::ExperimentResult>)> x)
+{
+	std::lock_guard<std::mutex> lock(ExperimentResultStartFunctionsMutex);
+	ExperimentResultStartFunctions.push_back(x);
+}
+
+void celero::AddSampleCompleteFunction(std::function<void(std::shared_ptr<celero::ExperimentResult>, uint64_t)> x)
+{
+	std::lock_guard<std::mutex> lock(SampleFunctionsMutex);
+	SampleFunctions.push_back(x);
+	HasSampleFunctions = true;
+}
@@ -18,6 +18,7 @@
 
 #include <celero/Archive.h>
 #include <celero/Benchmark.h>
+#include <celero/Cache.h>
 #include <celero/Callbacks.h>
 #include <celero/Celero.h>
 #include <celero/CommandLine.h>
@@ -25,18 +26,25 @@
 #include <celero/Distribution.h>
 #include <celero/Exceptions.h>
 #include <celero/Executor.h>
+#include <celero/Filter.h>
+#include <celero/JSON.h>
 #include <celero/JUnit.h>
+#include <celero/NDJSON.h>
 #include <celero/Print.h>
+#include <celero/ProgressStream.h>
+#include <celero/RegressionDetector.h>
 #include <celero/ResultTable.h>
 #include <celero/TestVector.h>
 #include <celero/UserDefinedMeasurement.h>
 #include <celero/Utilities.h>
+#include <celero/Warmup.h>
 
 #include <cassert>
 #include <cmath>
 #include <fstream>
 #include <iostream>
 #include <set>
+#include <sstream>
 
 using namespace celero;
 
@@ -102,7 +110,7 @@ std::shared_ptr<celero::Benchmark> celero::RegisterBaseline(const char* groupNam
 	return nullptr;
 }
 
-void celero::Run(int argc, char** argv)
+int celero::Run(int argc, char** argv)
 {
 #ifdef _DEBUG
 	std::cout << "Celero is running in Debug.  Results are for debugging only as any measurements made while in Debug are likely not representative "
@@ -114,13 +122,80 @@ void celero::Run(int argc, char** argv)
 	cmdline::parser args;
 	args.add("list", 'l', "Prints a list of all available benchmarks.");
 	args.add<std::string>("group", 'g', "Runs a specific group of benchmarks.", false, "");
+	args.add<std::string>("filter", 'f',
+						  "Runs only benchmarks matching a comma-separated list of \"Group.Experiment/ProblemSpace\" globs, or a \"regex:\" pattern.", false,
+						  "");
+	args.add<std::string>("exclude", 'x', "Skips benchmarks matching a comma-separated list of globs, or a \"regex:\" pattern, as with --filter.",
+						  false, "");
 	args.add<std::string>("outputTable", 't', "Saves a results table to the named file.", false, "");
 	args.add<std::string>("junit", 'j', "Saves a JUnit XML-formatted file to the named file.", false, "");
+	args.add<std::string>("json", 0, "Saves all results and the environment as a JSON document to the named file.", false, "");
+	args.add<std::string>("ndjson", 0, "Streams each result as one line of JSON to the named file (\"-\" for standard output) as it completes.", false,
+						  "");
 	args.add<std::string>("archive", 'a', "Saves or updates a result archive file.", false, "");
+	args.add<std::string>("archiveFormat", 0, "The format to save the result archive in: csv or binary.  Existing binary archives stay binary.", false,
+						  "csv", cmdline::oneof<std::string>("csv", "binary"));
+	args.add<std::string>("archiveConvert", 0, "Converts the archive named by --archive to the other format, saves it to the named file, and exits.",
+						  false, "");
+	args.add("archiveHistory", 0, "Keeps every run in a history file next to the archive, rather than only the best, worst, and current runs.");
+	args.add<std::string>("archiveLabel", 0, "A label, such as a commit hash or build number, recorded with each run in the archive history.", false,
+						  "");
+	args.add("archiveTrend", 0, "Prints a sparkline and trend slope for every benchmark in the archive history and exits.");
+	args.add<double>("regressionThreshold", 0,
+					 "Flags results more than this percent slower than their archived history and exits nonzero.  Requires --archive.", false, 0.0);
+	args.add<double>("regressionSigma", 0, "Flagged results must also be this many archived standard deviations slower.", false, 3.0);
+	args.add<std::string>("progressStream", 0,
+						  "Streams live progress events as NDJSON to \"fd:N\", a Unix domain socket \"unix:PATH\", or the named file or FIFO.", false,
+						  "");
+	args.add("progress", 0, "Shows a compact progress bar instead of the results table.");
+	args.add("quiet", 'q', "Same as --progress.");
 	args.add<uint64_t>("distribution", 'd', "Builds a file to help characterize the distribution of measurements and exits.", false, 0);
+	args.add<std::string>("warmup", 0,
+						  "Unrecorded warm-up samples before each problem space: a count, a duration such as \"200ms\", or \"stable:PERCENT[:MAX]\".",
+						  false, "1");
+	args.add<std::string>("coldCache", 0, "Empties the CPU caches, outside of timing, once per sample or after every iteration.", false, "none",
+						  cmdline::oneof<std::string>("none", "sample", "iteration"));
+	args.add<std::string>("coldCacheMethod", 0,
+						  "Empties the caches by streaming through a buffer larger than the last-level cache, or by evicting the fixture's data.",
+						  false, "flush", cmdline::oneof<std::string>("flush", "evict"));
+	args.add<std::string>("fixtureLifetime", 0,
+						  "Keeps each test fixture for one sample, problem space, or experiment, unless the fixture chooses its own lifetime.", false,
+						  "sample", cmdline::oneof<std::string>("sample", "problemSpace", "experiment"));
+	args.add<std::string>("throughputUnits", 0, "Scales the Bytes/sec column by powers of 1000 (si: kB/s, MB/s) or 1024 (binary: KiB/s, MiB/s).",
+						  false, "si", cmdline::oneof<std::string>("si", "binary"));
 	args.add<bool>("catchExceptions", 'e', "Allows Celero to catch exceptions and continue processing following benchmarks.", false, true);
 	args.parse_check(argc, argv);
 
+	// Register filter patterns first so that --list reflects them.
+	{
+		auto addPatterns = [](const std::string& x, bool (Filter::*add)(const std::string&)) {
+			// A regular expression may itself contain commas, so it is taken whole.
+			if(x.compare(0, 6, "regex:") == 0)
+			{
+				return (Filter::Instance().*add)(x);
+			}
+
+			std::istringstream patterns(x);
+			std::string pattern;
+
+			while(std::getline(patterns, pattern, ','))
+			{
+				if(pattern.empty() == false && (Filter::Instance().*add)(pattern) == false)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		};
+
+		if(addPatterns(args.get<std::string>("filter"), &Filter::addInclude) == false
+		   || addPatterns(args.get<std::string>("exclude"), &Filter::addExclude) == false)
+		{
+			return 1;
+		}
+	}
+
 	if(args.exist("list") == true)
 	{
 		auto& tests = celero::TestVector::Instance();
@@ -130,9 +205,33 @@ void celero::Run(int argc, char** argv)
 		{
 			auto bm = celero::TestVector::Instance()[i];
 
-			if(bm != nullptr)
+			if(bm == nullptr)
+			{
+				continue;
+			}
+
+			if(Filter::Instance().isActive() == false)
 			{
 				testNames.push_back(bm->getName());
+				continue;
+			}
+
+			// List every selected experiment by its full name when filtering.
+			const auto baseline = bm->getBaseline();
+
+			if(baseline != nullptr && Filter::Instance().matches(bm->getName(), baseline->getName()) == true)
+			{
+				testNames.push_back(bm->getName() + "." + baseline->getName());
+			}
+
+			for(size_t j = 0; j < bm->getExperimentSize(); j++)
+			{
+				const auto e = bm->getExperiment(j);
+
+				if(Filter::Instance().matches(bm->getName(), e->getName()) == true)
+				{
+					testNames.push_back(bm->getName() + "." + e->getName());
+				}
 			}
 		}
 
@@ -144,7 +243,16 @@ void celero::Run(int argc, char** argv)
 			std::cout << "\t" << i << std::endl;
 		}
 
-		return;
+		return 0;
+	}
+
+	// Has an NDJSON output stream been specified?  Opened before anything is printed, as console output moves to standard error when
+	// NDJSON is written to standard output.
+	const auto ndjsonFileName = args.get<std::string>("ndjson");
+	const auto mustCloseNDJSON = (ndjsonFileName.empty() == false);
+	if(mustCloseNDJSON == true)
+	{
+		celero::NDJSON::Instance().setFileName(ndjsonFileName);
 	}
 
 	// Initial output
@@ -162,6 +270,8 @@ void celero::Run(int argc, char** argv)
 
 	// Has a result output file been specified?
 	auto mustCloseFile = false;
+	auto mustSaveJUnit = false;
+	auto mustSaveArchive = false;
 	auto argument = args.get<std::string>("outputTable");
 	if(argument.empty() == false)
 	{
@@ -176,10 +286,55 @@ void celero::Run(int argc, char** argv)
 	argument = args.get<std::string>("archive");
 	if(argument.empty() == false)
 	{
+		const auto convertTo = args.get<std::string>("archiveConvert");
+
+		if(convertTo.empty() == false)
+		{
+			const auto outputFormat =
+				(celero::Archive::DetectFormat(argument) == celero::Archive::Format::Binary) ? celero::Archive::Format::CSV : celero::Archive::Format::Binary;
+
+			std::cout << "Converting archive " << argument << " to: " << convertTo << std::endl;
+			return (celero::Archive::Convert(argument, convertTo, outputFormat) == true) ? 0 : 1;
+		}
+
+		if(args.get<std::string>("archiveFormat") == "binary")
+		{
+			celero::Archive::Instance().setFormat(celero::Archive::Format::Binary);
+		}
+
+		const auto regressionThreshold = args.get<double>("regressionThreshold");
+
+		if(regressionThreshold > 0.0)
+		{
+			celero::RegressionDetector::Instance().setEnabled(true);
+			celero::RegressionDetector::Instance().setThreshold(regressionThreshold);
+			celero::RegressionDetector::Instance().setSigma(args.get<double>("regressionSigma"));
+		}
+
+		if(args.exist("archiveHistory") == true || args.exist("archiveTrend") == true || regressionThreshold > 0.0)
+		{
+			celero::Archive::Instance().setHistoryEnabled(true);
+			celero::Archive::Instance().setLabel(args.get<std::string>("archiveLabel"));
+		}
+
+		if(args.exist("archiveTrend") == true)
+		{
+			celero::Archive::Instance().setFileName(argument);
+			celero::Archive::Instance().getHistory().printTrends(std::cout);
+			return 0;
+		}
+
 		std::cout << "Archiving results to: " << argument << std::endl;
 		celero::Archive::Instance().setFileName(argument);
 
 		celero::AddExperimentResultCompleteFunction([](std::shared_ptr<celero::ExperimentResult> p) { celero::Archive::Instance().add(p); });
+		mustSaveArchive = true;
+	}
+	else if(args.get<double>("regressionThreshold") > 0.0)
+	{
+		// Without an archive there is nothing to compare against, and every run would silently pass.
+		std::cerr << "Error. --regressionThreshold requires --archive.\n";
+		return 1;
 	}
 
 	// Has a JUnit output file been specified?
@@ -190,6 +345,37 @@ void celero::Run(int argc, char** argv)
 		celero::JUnit::Instance().setFileName(argument);
 
 		celero::AddExperimentResultCompleteFunction([](std::shared_ptr<celero::ExperimentResult> p) { celero::JUnit::Instance().add(p); });
+		mustSaveJUnit = true;
+	}
+
+	// Has a JSON output file been specified?
+	argument = args.get<std::string>("json");
+	auto mustSaveJSON = false;
+	if(argument.empty() == false)
+	{
+		std::cout << "Writing JSON results to: " << argument << std::endl;
+		celero::JSON::Instance().setFileName(argument);
+
+		celero::AddExperimentResultCompleteFunction([](std::shared_ptr<celero::ExperimentResult> p) { celero::JSON::Instance().add(p); });
+		mustSaveJSON = true;
+	}
+
+	if(mustCloseNDJSON == true)
+	{
+		std::cout << "Streaming NDJSON results to: " << ndjsonFileName << std::endl;
+		celero::AddExperimentResultCompleteFunction([](std::shared_ptr<celero::ExperimentResult> p) { celero::NDJSON::Instance().add(p); });
+	}
+
+	// Has a live progress stream been specified?
+	argument = args.get<std::string>("progressStream");
+	if(argument.empty() == false && celero::ProgressStream::Instance().open(argument) == true)
+	{
+		celero::AddExperimentResultStartFunction([](std::shared_ptr<celero::ExperimentResult> p) { celero::ProgressStream::Instance().resultStart(p); });
+		celero::AddSampleCompleteFunction(
+			[](std::shared_ptr<celero::ExperimentResult> p, uint64_t t) { celero::ProgressStream::Instance().sampleComplete(p, t); });
+		celero::AddExperimentResultCompleteFunction(
+			[](std::shared_ptr<celero::ExperimentResult> p) { celero::ProgressStream::Instance().resultComplete(p); });
+		celero::AddExperimentCompleteFunction([](std::shared_ptr<celero::Experiment> p) { celero::ProgressStream::Instance().experimentComplete(p); });
 	}
 
 	// Has a flag to catch exceptions or not been specified?
@@ -198,37 +384,107 @@ void celero::Run(int argc, char** argv)
 		ExceptionSettings::SetCatchExceptions(args.get<bool>("catchExceptions"));
 	}
 
+	if(args.exist("warmup") == true && Warmup::Instance().setPolicy(args.get<std::string>("warmup")) == false)
+	{
+		std::cerr << "Error. The warm-up policy \"" << args.get<std::string>("warmup") << "\" is not valid.\n";
+		return 1;
+	}
+
+	if(args.exist("coldCache") == true)
+	{
+		const auto mode = args.get<std::string>("coldCache");
+
+		if(mode == "sample")
+		{
+			celero::cache::SetMode(celero::cache::Mode::Sample);
+		}
+		else if(mode == "iteration")
+		{
+			celero::cache::SetMode(celero::cache::Mode::Iteration);
+		}
+		else
+		{
+			celero::cache::SetMode(celero::cache::Mode::None);
+		}
+	}
+
+	if(args.exist("coldCacheMethod") == true)
+	{
+		celero::cache::SetMethod((args.get<std::string>("coldCacheMethod") == "evict") ? celero::cache::Method::Evict : celero::cache::Method::Flush);
+	}
+
+	if(args.exist("fixtureLifetime") == true)
+	{
+		const auto lifetime = args.get<std::string>("fixtureLifetime");
+
+		if(lifetime == "problemSpace")
+		{
+			Experiment::SetDefaultFixtureLifetime(TestFixture::FixtureLifetime::PerProblemSpace);
+		}
+		else if(lifetime == "experiment")
+		{
+			Experiment::SetDefaultFixtureLifetime(TestFixture::FixtureLifetime::PerExperiment);
+		}
+		else
+		{
+			Experiment::SetDefaultFixtureLifetime(TestFixture::FixtureLifetime::PerSample);
+		}
+	}
+
+	Printer::get().setBinaryUnits(args.get<std::string>("throughputUnits") == "binary");
+
+	if(args.exist("progress") == true || args.exist("quiet") == true)
+	{
+		Printer::get().setMode(Printer::Mode::Progress);
+		celero::AddExperimentCompleteFunction([](std::shared_ptr<celero::Experiment> p) { Printer::get().ExperimentComplete(p); });
+	}
+
 	// Has a run group been specified?
 	argument = args.get<std::string>("group");
 
-	// Collect all user-defined fields
+	// Collect all user-defined fields, and whether any fixture reports throughput.
 	std::set<std::string> userDefinedFields;
+	auto experimentCount = size_t(0);
+	auto reportsBytes = false;
+	auto reportsItems = false;
 	auto collectFromBenchmark = [&](std::shared_ptr<Benchmark> bmark) {
+		if(Filter::Instance().matches(bmark) == false)
+		{
+			return size_t(0);
+		}
+
 		// Collect from baseline
 		auto baselineExperiment = bmark->getBaseline();
-		if(baselineExperiment != nullptr)
+		if(baselineExperiment != nullptr && baselineExperiment->getFactory() != nullptr)
 		{
-			auto test = baselineExperiment->getFactory()->Create();
-			UserDefinedMeasurementCollector udmCollector(test);
-			for(const auto& fieldName : udmCollector.getFields(test))
-			{
-				userDefinedFields.insert(fieldName);
-			}
+			const auto& fields = baselineExperiment->getFactory()->getUserDefinedMeasurementFields();
+			userDefinedFields.insert(std::begin(fields), std::end(fields));
+			reportsBytes = reportsBytes || baselineExperiment->getFactory()->getReportsBytes();
+			reportsItems = reportsItems || baselineExperiment->getFactory()->getReportsItems();
 		}
 
 		// Collect from all experiments
 		const auto experimentSize = bmark->getExperimentSize();
+		experimentCount += ((baselineExperiment != nullptr) ? 1 : 0);
 
 		for(size_t i = 0; i < experimentSize; i++)
 		{
 			auto e = bmark->getExperiment(i);
 			assert(e != nullptr);
 
-			auto test = baselineExperiment->getFactory()->Create();
-			UserDefinedMeasurementCollector udmCollector(test);
-			for(const auto& fieldName : udmCollector.getFields(test))
+			if(Filter::Instance().matches(e) == false)
+			{
+				continue;
+			}
+
+			experimentCount++;
+
+			if(e->getFactory() != nullptr)
 			{
-				userDefinedFields.insert(fieldName);
+				const auto& fields = e->getFactory()->getUserDefinedMeasurementFields();
+				userDefinedFields.insert(std::begin(fields), std::end(fields));
+				reportsBytes = reportsBytes || e->getFactory()->getReportsBytes();
+				reportsItems = reportsItems || e->getFactory()->getReportsItems();
 			}
 		}
 
@@ -253,7 +509,7 @@ void celero::Run(int argc, char** argv)
 		else
 		{
 			std::cerr << "Error. The specified group \"" << argument << "\" does not exist.\n";
-			return;
+			return 1;
 		}
 	}
 	else
@@ -273,6 +529,14 @@ void celero::Run(int argc, char** argv)
 	std::vector<std::string> userDefinedFieldsOrder(userDefinedFields.begin(), userDefinedFields.end());
 
 	Printer::get().initialize(userDefinedFieldsOrder);
+	Printer::get().setThroughputColumns(reportsBytes, reportsItems);
+
+	if(mustCloseFile == true)
+	{
+		celero::ResultTable::Instance().setUserDefinedFields(userDefinedFieldsOrder);
+	}
+
+	Printer::get().setProgressTotal(experimentCount);
 	Printer::get().TableBanner(maxGroupNameLength);
 
 	const auto startTime = celero::timer::GetSystemTime();
@@ -288,11 +552,30 @@ void celero::Run(int argc, char** argv)
 
 	const auto totalTime = celero::timer::ConvertSystemTime(celero::timer::GetSystemTime() - startTime);
 
+	Printer::get().ProgressComplete();
+
 	if(mustCloseFile == true)
 	{
 		celero::ResultTable::Instance().closeFile();
 	}
 
+	if(mustSaveArchive == true)
+	{
+		celero::Archive::Instance().save();
+	}
+
+	if(mustSaveJUnit == true)
+	{
+		celero::JUnit::Instance().save();
+	}
+
+	if(mustSaveJSON == true)
+	{
+		celero::JSON::Instance().save();
+	}
+
+	celero::ProgressStream::Instance().close();
+
 	// Final output.
 	auto hours = std::to_string(static_cast<int>(totalTime) / SecondsPerHour);
 	auto minutes = std::to_string((static_cast<int>(totalTime) % SecondsPerHour) / SecondsPerMinute);
@@ -314,4 +597,19 @@ void celero::Run(int argc, char** argv)
 	}
 
 	std::cout << "Completed in " << hours << ":" << minutes << ":" << seconds << std::endl;
+
+	const auto regressions = celero::RegressionDetector::Instance().getRegressionCount();
+
+	if(regressions > 0)
+	{
+		std::cout << "Performance regressions detected: " << regressions << std::endl;
+	}
+
+	// Closed last, as it sends std::cout back to standard output.
+	if(mustCloseNDJSON == true)
+	{
+		celero::NDJSON::Instance().closeFile();
+	}
+
+	return (regressions > 0) ? 1 : 0;
 }
@@ -35,169 +35,152 @@ auto WinColor() -> decltype(GetStdHandle(STD_OUTPUT_HANDLE))
 	GetConsoleScreenBufferInfo(h, &csbiInfo);
 	return h;
 }
-#endif
 
 void Red()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, FOREGROUND_RED);
-#else
-	std::cout << "\033[49m\033[31m";
-#endif
 }
 
 void RedBold()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, FOREGROUND_RED | FOREGROUND_INTENSITY);
-#else
-	std::cout << "\033[49m\033[1;31m";
-#endif
 }
 
 void Green()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, FOREGROUND_GREEN);
-#else
-	std::cout << "\033[49m\033[32m";
-#endif
 }
 
 void GreenBold()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, FOREGROUND_GREEN | FOREGROUND_INTENSITY);
-#else
-	std::cout << "\033[49m\033[1;32m";
-#endif
 }
 
 void Blue()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, FOREGROUND_BLUE);
-#else
-	std::cout << "\033[49m\033[34m";
-#endif
 }
 
 void BlueBold()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, FOREGROUND_BLUE | FOREGROUND_INTENSITY);
-#else
-	std::cout << "\033[49m\033[1;34m";
-#endif
 }
 
 void Cyan()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, FOREGROUND_BLUE | FOREGROUND_GREEN);
-#else
-	std::cout << "\033[49m\033[36m";
-#endif
 }
 
 void CyanBold()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, FOREGROUND_BLUE | FOREGROUND_GREEN | FOREGROUND_INTENSITY);
-#else
-	std::cout << "\033[49m\033[1;36m";
-#endif
 }
 
 void Yellow()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, FOREGROUND_RED | FOREGROUND_GREEN);
-#else
-	std::cout << "\033[49m\033[33m";
-#endif
 }
 
 void YellowBold()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_INTENSITY);
-#else
-	std::cout << "\033[49m\033[1;33m";
-#endif
 }
 
 void White()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
-#else
-	std::cout << "\033[49m\033[37m";
-#endif
 }
 
 void WhiteBold()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE | FOREGROUND_INTENSITY);
-#else
-	std::cout << "\033[49m\033[1;37m";
-#endif
 }
 
 void WhiteOnRed()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, BACKGROUND_RED | FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
-#else
-	std::cout << "\033[41m\033[37m";
-#endif
 }
 
 void WhiteOnRedBold()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, BACKGROUND_RED | FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE | FOREGROUND_INTENSITY);
-#else
-	std::cout << "\033[41m\033[1;37m";
-#endif
 }
 
 void PurpleBold()
 {
-#ifdef _WIN32
 	auto h = WinColor();
 	SetConsoleTextAttribute(h, FOREGROUND_RED | FOREGROUND_BLUE | FOREGROUND_INTENSITY);
-#else
-	std::cout << "\033[49m\033[1;38m";
-#endif
 }
 
 void Default()
 {
-#ifdef _WIN32
 	White();
+}
+#endif
+
+const char* celero::console::GetConsoleColorCode(const celero::console::ConsoleColor x)
+{
+#ifdef _WIN32
+	// Windows consoles are colored through the console API rather than escape sequences.
+	(void)x;
+	return "";
 #else
-	std::cout << "\033[0m";
+	switch(x)
+	{
+		case console::ConsoleColor::Red:
+			return "\033[49m\033[31m";
+		case console::ConsoleColor::Red_Bold:
+			return "\033[49m\033[1;31m";
+		case console::ConsoleColor::Green:
+			return "\033[49m\033[32m";
+		case console::ConsoleColor::Green_Bold:
+			return "\033[49m\033[1;32m";
+		case console::ConsoleColor::Blue:
+			return "\033[49m\033[34m";
+		case console::ConsoleColor::Blue_Bold:
+			return "\033[49m\033[1;34m";
+		case console::ConsoleColor::Cyan:
+			return "\033[49m\033[36m";
+		case console::ConsoleColor::Cyan_Bold:
+			return "\033[49m\033[1;36m";
+		case console::ConsoleColor::Yellow:
+			return "\033[49m\033[33m";
+		case console::ConsoleColor::Yellow_Bold:
+			return "\033[49m\033[1;33m";
+		case console::ConsoleColor::White:
+			return "\033[49m\033[37m";
+		case console::ConsoleColor::White_Bold:
+			return "\033[49m\033[1;37m";
+		case console::ConsoleColor::WhiteOnRed:
+			return "\033[41m\033[37m";
+		case console::ConsoleColor::WhiteOnRed_Bold:
+			return "\033[41m\033[1;37m";
+		case console::ConsoleColor::Purple_Bold:
+			return "\033[49m\033[1;38m";
+		case console::ConsoleColor::Default:
+		default:
+			return "\033[0m";
+	}
 #endif
 }
 
 void celero::console::SetConsoleColor(const celero::console::ConsoleColor x)
 {
+#ifdef _WIN32
 	switch(x)
 	{
 		case console::ConsoleColor::Red:
@@ -250,4 +233,7 @@ void celero::console::SetConsoleColor(const celero::console::ConsoleColor x)
 			Default();
 			break;
 	}
+#else
+	std::cout << GetConsoleColorCode(x);
+#endif
 }
@@ -22,11 +22,14 @@
 #include <celero/Console.h>
 #include <celero/Exceptions.h>
 #include <celero/Executor.h>
+#include <celero/Filter.h>
 #include <celero/Memory.h>
 #include <celero/Print.h>
+#include <celero/RegressionDetector.h>
 #include <celero/TestVector.h>
 #include <celero/UserDefinedMeasurementCollector.h>
 #include <celero/Utilities.h>
+#include <celero/Warmup.h>
 
 #include <algorithm>
 #include <cassert>
@@ -34,10 +37,69 @@
 
 using namespace celero;
 
+///
+/// \class FixtureSource
+///
+/// A local class to hand out the test fixtures of one experiment according to its fixture lifetime.
+///
+class FixtureSource
+{
+public:
+	explicit FixtureSource(celero::Experiment* x) : experiment(x), lifetime(x->getFixtureLifetime())
+	{
+	}
+
+	///
+	/// Prepares for the runs of the next problem space.
+	///
+	void beginProblemSpace(std::shared_ptr<celero::ExperimentResult> r)
+	{
+		if(this->lifetime == TestFixture::FixtureLifetime::PerProblemSpace)
+		{
+			this->fixture.reset();
+		}
+		else if(this->lifetime == TestFixture::FixtureLifetime::PerExperiment && this->fixture != nullptr)
+		{
+			this->fixture->onReuse(r->getProblemSpace().get());
+		}
+	}
+
+	///
+	/// The fixture to use for the next calibration, warm-up, or sample run.
+	///
+	std::shared_ptr<TestFixture> get()
+	{
+		if(this->lifetime == TestFixture::FixtureLifetime::PerSample)
+		{
+			return this->experiment->getFactory()->Create();
+		}
+
+		if(this->fixture == nullptr)
+		{
+			this->fixture = this->experiment->getFactory()->Create();
+		}
+
+		return this->fixture;
+	}
+
+	///
+	/// True if the same fixture is used for more than one run.
+	///
+	bool getIsReused() const
+	{
+		return this->lifetime != TestFixture::FixtureLifetime::PerSample;
+	}
+
+private:
+	celero::Experiment* experiment{nullptr};
+	TestFixture::FixtureLifetime lifetime{TestFixture::FixtureLifetime::PerSample};
+	std::shared_ptr<TestFixture> fixture;
+};
+
 ///
 /// A local function to figure out how many iterations and samples are required when the user doesn't specify any.
 ///
-bool AdjustSampleAndIterationSize(std::shared_ptr<celero::ExperimentResult> r)
+bool AdjustSampleAndIterationSize(std::shared_ptr<celero::ExperimentResult> r, FixtureSource& fixtures)
 {
 	if((r->getExperiment()->getSamples() == 0) || (r->getExperiment()->getIterations() == 0))
 	{
@@ -46,7 +108,7 @@ bool AdjustSampleAndIterationSize(std::shared_ptr<celero::ExperimentResult> r)
 		const auto minTestTime = static_cast<int64_t>(celero::timer::CachePerformanceFrequency(true) * 1e6) * 2;
 
 		// Compute a good number to use for iterations and set the sample size to 30.
-		auto test = r->getExperiment()->getFactory()->Create();
+		auto test = fixtures.get();
 		auto testTime = int64_t(0);
 		auto testIterations = int64_t(1);
 
@@ -80,9 +142,7 @@ bool AdjustSampleAndIterationSize(std::shared_ptr<celero::ExperimentResult> r)
 			experiment->setSamples(30);
 		}
 
-		auto ps = r->getProblemSpace();
-		ps->Iterations = iterations;
-		r->setProblemSpaceValue(ps, r->getProblemSpaceValueScale());
+		r->setProblemSpaceIterations(iterations);
 	}
 
 	return true;
@@ -91,19 +151,23 @@ bool AdjustSampleAndIterationSize(std::shared_ptr<celero::ExperimentResult> r)
 ///
 /// A local function to support running an individual user-defined function for measurement.
 ///
-bool ExecuteProblemSpace(std::shared_ptr<celero::ExperimentResult> r)
+bool ExecuteProblemSpace(std::shared_ptr<celero::ExperimentResult> r, FixtureSource& fixtures)
 {
+	// Most fixtures have no user-defined measurements, so don't ask them for their (empty) list after every sample.
+	const auto hasUserDefinedMeasurements = (r->getExperiment()->getFactory()->getUserDefinedMeasurementNames().empty() == false);
+
 	// Define a small internal function object to use to uniformly execute the tests.
-	auto testRunner = [r](const bool record, std::shared_ptr<UserDefinedMeasurementCollector> udmCollector)
+	auto testRunner = [r, &fixtures, hasUserDefinedMeasurements](const bool record,
+																std::shared_ptr<UserDefinedMeasurementCollector> udmCollector) -> std::pair<bool, uint64_t>
 	{
-		auto test = r->getExperiment()->getFactory()->Create();
+		auto test = fixtures.get();
 
 		const auto runResult = RunAndCatchExc(*test, r->getExperiment()->getThreads(), r->getProblemSpaceIterations(), r->getProblemSpace());
 
 		if(runResult.first == false)
 		{
 			// something bad happened
-			return false;
+			return runResult;
 		}
 
 		const auto testTime = runResult.second;
@@ -111,39 +175,81 @@ bool ExecuteProblemSpace(std::shared_ptr<celero::ExperimentResult> r)
 		// Save test results
 		if(record == true)
 		{
+			r->setBytesPerIteration(test->getBytesPerIteration(r->getProblemSpace().get()));
+			r->setItemsPerIteration(test->getItemsPerIteration(r->getProblemSpace().get()));
 			r->addRunTimeSample(testTime);
 			r->addMemorySample(celero::GetRAMVirtualUsedByCurrentProcess());
 			r->getExperiment()->incrementTotalRunTime(testTime);
 
-			if(udmCollector != nullptr)
+			celero::impl::SampleComplete(r, testTime);
+
+			if(hasUserDefinedMeasurements == true)
 			{
-				udmCollector->collect(test);
+				const auto udms = test->getUserDefinedMeasurements();
+
+				for(const auto& udm : udms)
+				{
+					udm->onSample(testTime, r->getProblemSpaceIterations());
+				}
+
+				// A reused fixture accumulates its measurements itself and is collected once all samples are done.
+				if(udmCollector != nullptr && fixtures.getIsReused() == false)
+				{
+					udmCollector->collect(udms);
+				}
 			}
 		}
 
-		return true;
+		return runResult;
 	};
 
 	if(r->getExperiment()->getSamples() > 0)
 	{
-		// make a first pass to maybe cache instructions/data or other kinds of fist-run-only costs
-		if(testRunner(false, nullptr) == false)
+		// Warm up caches, branch predictors, page mappings, and the CPU clock before recording, as long as the warm-up policy asks.
+		std::vector<uint64_t> warmupTimes;
+		const auto warmupStart = celero::timer::GetSystemTime();
+
+		while(Warmup::Instance().isComplete(warmupTimes, celero::timer::GetSystemTime() - warmupStart) == false)
 		{
-			r->setFailure(true);
-			return false;
+			const auto warmupResult = testRunner(false, nullptr);
+
+			if(warmupResult.first == false)
+			{
+				r->setFailure(true);
+				return false;
+			}
+
+			warmupTimes.push_back(warmupResult.second);
+			r->addWarmupSample(warmupResult.second);
 		}
 
-		auto udmCollector = std::make_shared<UserDefinedMeasurementCollector>(r->getExperiment()->getFactory()->Create());
+		auto udmCollector = std::make_shared<UserDefinedMeasurementCollector>(r->getExperiment()->getFactory()->getUserDefinedMeasurementNames());
+
+		// Don't count what a reused fixture measured during calibration, warm-up, or earlier problem spaces.
+		if(fixtures.getIsReused() == true)
+		{
+			for(const auto& udm : fixtures.get()->getUserDefinedMeasurements())
+			{
+				udm->reset();
+			}
+		}
 
 		for(auto i = r->getExperiment()->getSamples(); i > 0; --i)
 		{
-			if(testRunner(true, udmCollector) == false)
+			if(testRunner(true, udmCollector).first == false)
 			{
 				r->setFailure(true);
 				return false;
 			}
 		}
 
+		if(fixtures.getIsReused() == true)
+		{
+			udmCollector->collect(fixtures.get());
+		}
+
+		// The measurements of a reused fixture will be reset for its next problem space.
+		udmCollector->freeze();
 		r->setUserDefinedMeasurements(udmCollector);
 		r->setComplete(true);
 	}
@@ -157,6 +263,21 @@ bool ExecuteProblemSpace(std::shared_ptr<celero::ExperimentResult> r)
 	return true;
 }
 
+///
+/// A local function to check that the filter leaves at least one of the experiment's problem spaces, including the default one used when
+/// the fixture specifies none.
+///
+bool HasSelectedProblemSpace(std::shared_ptr<celero::Experiment> e, const std::vector<std::shared_ptr<TestFixture::ExperimentValue>>& testValues)
+{
+	if(testValues.empty() == true)
+	{
+		return Filter::Instance().matches(e, static_cast<int64_t>(TestFixture::Constants::NoProblemSpaceValue));
+	}
+
+	return std::any_of(std::begin(testValues), std::end(testValues),
+					   [e](std::shared_ptr<TestFixture::ExperimentValue> x) { return Filter::Instance().matches(e, *x); });
+}
+
 void executor::RunAll()
 {
 	executor::RunAllBaselines();
@@ -201,23 +322,31 @@ bool executor::RunBaseline(std::shared_ptr<Benchmark> bmark)
 
 	if(baselineExperiment != nullptr)
 	{
-		// Populate the problem space with a test fixture instantiation.
+		// Nothing in this group was selected, so don't instantiate any of its fixtures.
+		if(Filter::Instance().matches(bmark) == false)
 		{
-			const auto baselineFixture = baselineExperiment->getFactory()->Create();
-			const auto testValues = baselineFixture->getExperimentValues();
-			const auto valueResultScale = baselineFixture->getExperimentValueResultScale();
+			return false;
+		}
+
+		// Populate the problem space from the factory's cached fixture metadata.
+		{
+			auto factory = baselineExperiment->getFactory();
+			const auto& testValues = factory->getExperimentValues();
+			const auto valueResultScale = factory->getExperimentValueResultScale();
+
+			if(HasSelectedProblemSpace(baselineExperiment, testValues) == false)
+			{
+				return false;
+			}
 
 			for(auto i : testValues)
 			{
-				if(i->Iterations > 0)
+				if(Filter::Instance().matches(baselineExperiment, *i) == false)
 				{
-					baselineExperiment->addProblemSpace(i, static_cast<double>(valueResultScale));
-				}
-				else
-				{
-					i->Iterations = baselineExperiment->getIterations();
-					baselineExperiment->addProblemSpace(i, static_cast<double>(valueResultScale));
+					continue;
 				}
+
+				baselineExperiment->addProblemSpace(i, static_cast<double>(valueResultScale));
 			}
 
 			// Add a single default problem space if none was specified.
@@ -229,21 +358,29 @@ bool executor::RunBaseline(std::shared_ptr<Benchmark> bmark)
 			}
 		}
 
+		FixtureSource fixtures(baselineExperiment.get());
+
 		for(size_t i = 0; i < baselineExperiment->getResultSize(); i++)
 		{
 			auto r = baselineExperiment->getResult(i);
 			assert(r != nullptr);
 
+			fixtures.beginProblemSpace(r);
+
 			Printer::get().TableRowExperimentHeader(r->getExperiment());
 
 			// Do a quick sample, if necessary, and adjust sample and iteration sizes, if necessary.
-			if(AdjustSampleAndIterationSize(r) == true)
+			if(AdjustSampleAndIterationSize(r, fixtures) == true)
 			{
 				// Describe the beginning of the run.
 				Printer::get().TableRowProblemSpaceHeader(r);
+				celero::impl::ExperimentResultStart(r);
 
-				if(ExecuteProblemSpace(r))
+				if(ExecuteProblemSpace(r, fixtures))
 				{
+					// Compare against the archived history before the result is reported and archived.
+					RegressionDetector::Instance().evaluate(r);
+
 					// Describe the end of the run.
 					Printer::get().TableResult(r);
 				}
@@ -253,6 +390,11 @@ bool executor::RunBaseline(std::shared_ptr<Benchmark> bmark)
 				r->setFailure(true);
 			}
 
+			if(r->getFailure() == true)
+			{
+				Printer::get().TableRowFailure("Failure");
+			}
+
 			celero::impl::ExperimentResultComplete(r);
 		}
 
@@ -292,6 +434,12 @@ void executor::Run(std::shared_ptr<Experiment> e)
 		return;
 	}
 
+	// Skip unselected experiments before any of their fixtures are created.
+	if(Filter::Instance().matches(e) == false)
+	{
+		return;
+	}
+
 	auto bmark = e->getBenchmark();
 	if(bmark == nullptr)
 	{
@@ -319,36 +467,31 @@ void executor::Run(std::shared_ptr<Experiment> e)
 		executor::RunBaseline(bmark);
 	}
 
-	// Populate the problem space with a fake test fixture instantiation.
+	// Populate the problem space from the factory's cached fixture metadata.
 	{
 		auto factory = e->getFactory();
 
-		if(factory == nullptr)
+		if(factory == nullptr || factory->getIsValid() == false)
 		{
 			return;
 		}
 
-		auto factoryCreate = factory->Create();
+		const auto& testValues = factory->getExperimentValues();
+		const auto valueResultScale = factory->getExperimentValueResultScale();
 
-		if(factoryCreate == nullptr)
+		if(HasSelectedProblemSpace(e, testValues) == false)
 		{
 			return;
 		}
 
-		const auto testValues = factoryCreate->getExperimentValues();
-		const auto valueResultScale = factoryCreate->getExperimentValueResultScale();
-
 		for(auto i : testValues)
 		{
-			if(i->Iterations > 0)
-			{
-				e->addProblemSpace(i, valueResultScale);
-			}
-			else
+			if(Filter::Instance().matches(e, *i) == false)
 			{
-				i->Iterations = e->getIterations();
-				e->addProblemSpace(i, valueResultScale);
+				continue;
 			}
+
+			e->addProblemSpace(i, valueResultScale);
 		}
 
 		// Add a single default problem space if none was specified.
@@ -359,23 +502,30 @@ void executor::Run(std::shared_ptr<Experiment> e)
 		}
 	}
 
+	FixtureSource fixtures(e.get());
+
 	// Result size will grow based on the problem spaces added above.
 	for(size_t i = 0; i < e->getResultSize(); i++)
 	{
 		auto r = e->getResult(i);
+		fixtures.beginProblemSpace(r);
 
 		Printer::get().TableRowExperimentHeader(r->getExperiment());
 
 		// Do a quick sample, if necessary, and adjust sample and iteration sizes, if necessary.
-		const auto adjustSuccess = AdjustSampleAndIterationSize(r);
+		const auto adjustSuccess = AdjustSampleAndIterationSize(r, fixtures);
 
 		if(adjustSuccess == true)
 		{
 			// Describe the beginning of the run.
 			Printer::get().TableRowProblemSpaceHeader(r);
+			celero::impl::ExperimentResultStart(r);
 
-			if(ExecuteProblemSpace(r))
+			if(ExecuteProblemSpace(r, fixtures))
 			{
+				// Compare against the archived history before the result is reported and archived.
+				RegressionDetector::Instance().evaluate(r);
+
 				// Describe the end of the run.
 				Printer::get().TableResult(r);
 			}
@@ -385,6 +535,11 @@ void executor::Run(std::shared_ptr<Experiment> e)
 			r->setFailure(true);
 		}
 
+		if(r->getFailure() == true)
+		{
+			Printer::get().TableRowFailure("Failure");
+		}
+
 		celero::impl::ExperimentResultComplete(r);
 	}
 
@@ -108,8 +108,16 @@ public:
 	uint64_t totalRunTime{0};
 
 	bool isBaselineCase{false};
+
+	/// Default until explicitly set on this experiment.
+	TestFixture::FixtureLifetime fixtureLifetime{TestFixture::FixtureLifetime::Default};
+
+	/// Used when neither an experiment nor its fixture chooses a lifetime.
+	static TestFixture::FixtureLifetime DefaultFixtureLifetime;
 };
 
+TestFixture::FixtureLifetime Experiment::Impl::DefaultFixtureLifetime{TestFixture::FixtureLifetime::PerSample};
+
 Experiment::Experiment() : pimpl()
 {
 }
@@ -270,10 +278,50 @@ std::shared_ptr<Factory> Experiment::getFactory() const
 	return this->pimpl->factory;
 }
 
+void Experiment::setFixtureLifetime(TestFixture::FixtureLifetime x)
+{
+	this->pimpl->fixtureLifetime = x;
+}
+
+TestFixture::FixtureLifetime Experiment::getFixtureLifetime() const
+{
+	if(this->pimpl->fixtureLifetime != TestFixture::FixtureLifetime::Default)
+	{
+		return this->pimpl->fixtureLifetime;
+	}
+
+	if(this->pimpl->factory != nullptr && this->pimpl->factory->getFixtureLifetime() != TestFixture::FixtureLifetime::Default)
+	{
+		return this->pimpl->factory->getFixtureLifetime();
+	}
+
+	return Impl::DefaultFixtureLifetime;
+}
+
+void Experiment::SetDefaultFixtureLifetime(TestFixture::FixtureLifetime x)
+{
+	// Default would be circular.
+	if(x != TestFixture::FixtureLifetime::Default)
+	{
+		Impl::DefaultFixtureLifetime = x;
+	}
+}
+
+TestFixture::FixtureLifetime Experiment::GetDefaultFixtureLifetime()
+{
+	return Impl::DefaultFixtureLifetime;
+}
+
 void Experiment::addProblemSpace(std::shared_ptr<celero::TestFixture::ExperimentValue> x, double scale)
 {
 	auto r = std::make_shared<celero::ExperimentResult>(this);
 	r->setProblemSpaceValue(x, scale);
+
+	if(r->getProblemSpaceIterations() == 0)
+	{
+		r->setProblemSpaceIterations(this->getIterations());
+	}
+
 	this->pimpl->results.push_back(r);
 }
 
@@ -313,3 +361,21 @@ std::shared_ptr<celero::ExperimentResult> Experiment::getResultByValue(int64_t x
 
 	return r;
 }
+
+std::shared_ptr<celero::ExperimentResult> Experiment::getResultByValue(const celero::TestFixture::ExperimentValue& x)
+{
+	std::shared_ptr<celero::ExperimentResult> r;
+
+	const auto found = std::find_if(std::begin(this->pimpl->results), std::end(this->pimpl->results),
+									[&x](std::shared_ptr<celero::ExperimentResult> i) -> bool {
+										const auto ps = i->getProblemSpace();
+										return (ps != nullptr) && (ps->isSameProblemSpace(x) == true);
+									});
+
+	if(found != std::end(this->pimpl->results))
+	{
+		r = (*found);
+	}
+
+	return r;
+}
@@ -45,11 +45,22 @@ public:
 	Statistics<int64_t> statsTime;
 	Statistics<int64_t> statsRAM;
 
+	/// Warm-up samples are never mixed into the measured statistics.
+	Statistics<int64_t> statsWarmup;
+	uint64_t warmupFirst{0};
+
 	std::shared_ptr<UserDefinedMeasurementCollector> udmCollector;
 
 	std::shared_ptr<celero::TestFixture::ExperimentValue> problemSpace;
 	double problemSpaceValueScale{1.0};
 
+	/// Kept apart from the problem space value, which may be shared with other experiments.
+	uint64_t problemSpaceIterations{0};
+
+	/// What one iteration processes, as reported by the fixture.
+	int64_t bytesPerIteration{0};
+	int64_t itemsPerIteration{0};
+
 	/// A pointer back to our owning Experiment parent.
 	Experiment* parent{nullptr};
 
@@ -58,6 +69,9 @@ public:
 
 	/// A "failure" flag.
 	bool failure{false};
+
+	/// The archived us/Iteration this result regressed against.  Zero when it did not regress.
+	double regressionReference{0.0};
 };
 
 ExperimentResult::ExperimentResult()
@@ -81,6 +95,7 @@ void ExperimentResult::setProblemSpaceValue(std::shared_ptr<celero::TestFixture:
 {
 	this->pimpl->problemSpace = x;
 	this->pimpl->problemSpaceValueScale = scale;
+	this->pimpl->problemSpaceIterations = (x != nullptr && x->Iterations > 0) ? static_cast<uint64_t>(x->Iterations) : 0;
 }
 
 std::shared_ptr<celero::TestFixture::ExperimentValue> ExperimentResult::getProblemSpace() const
@@ -98,19 +113,29 @@ int64_t ExperimentResult::getProblemSpaceValue() const
 	return 0;
 }
 
+std::string ExperimentResult::getProblemSpaceParameters() const
+{
+	if(this->pimpl->problemSpace)
+	{
+		return this->pimpl->problemSpace->getParameterString();
+	}
+
+	return std::string();
+}
+
 double ExperimentResult::getProblemSpaceValueScale() const
 {
 	return this->pimpl->problemSpaceValueScale;
 }
 
-uint64_t ExperimentResult::getProblemSpaceIterations() const
+void ExperimentResult::setProblemSpaceIterations(uint64_t x)
 {
-	if(this->pimpl->problemSpace)
-	{
-		return this->pimpl->problemSpace->Iterations;
-	}
+	this->pimpl->problemSpaceIterations = x;
+}
 
-	return 0;
+uint64_t ExperimentResult::getProblemSpaceIterations() const
+{
+	return this->pimpl->problemSpaceIterations;
 }
 
 const Statistics<int64_t>& ExperimentResult::getTimeStatistics() const
@@ -133,6 +158,26 @@ void ExperimentResult::addMemorySample(const int64_t x)
 	this->pimpl->statsRAM.addSample(static_cast<int64_t>(x));
 }
 
+void ExperimentResult::addWarmupSample(const uint64_t x)
+{
+	if(this->pimpl->statsWarmup.getSize() == 0)
+	{
+		this->pimpl->warmupFirst = x;
+	}
+
+	this->pimpl->statsWarmup.addSample(static_cast<int64_t>(x));
+}
+
+const Statistics<int64_t>& ExperimentResult::getWarmupStatistics() const
+{
+	return this->pimpl->statsWarmup;
+}
+
+uint64_t ExperimentResult::getWarmupFirstRunTime() const
+{
+	return this->pimpl->warmupFirst;
+}
+
 uint64_t ExperimentResult::getRunTime() const
 {
 	return static_cast<uint64_t>(this->pimpl->statsTime.getMin());
@@ -145,9 +190,9 @@ int64_t ExperimentResult::getRAM() const
 
 double ExperimentResult::getUsPerCall() const
 {
-	if(this->pimpl->failure == false && this->pimpl->problemSpace && this->pimpl->problemSpace->Iterations > 0)
+	if(this->pimpl->failure == false && this->pimpl->problemSpace && this->pimpl->problemSpaceIterations > 0)
 	{
-		return static_cast<double>(this->pimpl->statsTime.getMin()) / static_cast<double>(this->pimpl->problemSpace->Iterations);
+		return static_cast<double>(this->pimpl->statsTime.getMin()) / static_cast<double>(this->pimpl->problemSpaceIterations);
 	}
 
 	return 0.0;
@@ -169,13 +214,43 @@ double ExperimentResult::getUnitsPerSecond() const
 {
 	if(this->pimpl->problemSpace && this->pimpl->problemSpaceValueScale > 0.0)
 	{
-		return (this->pimpl->problemSpace->Value * this->pimpl->problemSpace->Iterations / this->pimpl->problemSpaceValueScale)
+		return (this->pimpl->problemSpace->Value * static_cast<int64_t>(this->pimpl->problemSpaceIterations) / this->pimpl->problemSpaceValueScale)
 			   / (this->pimpl->statsTime.getMin() * celero::UsToSec);
 	}
 
 	return 0.0;
 }
 
+void ExperimentResult::setBytesPerIteration(int64_t x)
+{
+	this->pimpl->bytesPerIteration = x;
+}
+
+int64_t ExperimentResult::getBytesPerIteration() const
+{
+	return this->pimpl->bytesPerIteration;
+}
+
+void ExperimentResult::setItemsPerIteration(int64_t x)
+{
+	this->pimpl->itemsPerIteration = x;
+}
+
+int64_t ExperimentResult::getItemsPerIteration() const
+{
+	return this->pimpl->itemsPerIteration;
+}
+
+double ExperimentResult::getBytesPerSecond() const
+{
+	return (this->pimpl->bytesPerIteration > 0) ? static_cast<double>(this->pimpl->bytesPerIteration) * this->getCallsPerSecond() : 0.0;
+}
+
+double ExperimentResult::getItemsPerSecond() const
+{
+	return (this->pimpl->itemsPerIteration > 0) ? static_cast<double>(this->pimpl->itemsPerIteration) * this->getCallsPerSecond() : 0.0;
+}
+
 double ExperimentResult::getBaselineMeasurement() const
 {
 	if(this->pimpl->parent->getIsBaselineCase() == false)
@@ -188,7 +263,8 @@ double ExperimentResult::getBaselineMeasurement() const
 
 			if(baselineExperiment != nullptr)
 			{
-				const auto baselineResult = baselineExperiment->getResultByValue(this->getProblemSpaceValue());
+				const auto baselineResult = (this->pimpl->problemSpace != nullptr) ? baselineExperiment->getResultByValue(*this->pimpl->problemSpace)
+																				  : baselineExperiment->getResultByValue(this->getProblemSpaceValue());
 
 				if(baselineResult != nullptr)
 				{
@@ -229,6 +305,21 @@ bool ExperimentResult::getFailure() const
 	return this->pimpl->failure;
 }
 
+void ExperimentResult::setRegressionReference(double x)
+{
+	this->pimpl->regressionReference = x;
+}
+
+double ExperimentResult::getRegressionReference() const
+{
+	return this->pimpl->regressionReference;
+}
+
+bool ExperimentResult::getRegression() const
+{
+	return this->pimpl->regressionReference > 0.0;
+}
+
 void ExperimentResult::setUserDefinedMeasurements(std::shared_ptr<UserDefinedMeasurementCollector> x)
 {
 	this->pimpl->udmCollector = x;
@@ -0,0 +1,143 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Factory.h>
+#include <celero/PimplImpl.h>
+#include <celero/UserDefinedMeasurement.h>
+
+using namespace celero;
+
+///
+/// \class Impl
+///
+class celero::Factory::Impl
+{
+public:
+	std::vector<std::shared_ptr<TestFixture::ExperimentValue>> experimentValues;
+	std::vector<std::string> userDefinedMeasurementNames;
+	std::vector<std::string> userDefinedMeasurementFields;
+	double experimentValueResultScale{1.0};
+	TestFixture::FixtureLifetime fixtureLifetime{TestFixture::FixtureLifetime::Default};
+	bool reportsBytes{false};
+	bool reportsItems{false};
+	bool isCached{false};
+	bool isValid{false};
+};
+
+Factory::Factory() : pimpl()
+{
+}
+
+Factory::~Factory()
+{
+}
+
+bool Factory::getIsValid()
+{
+	this->cacheMetadata();
+	return this->pimpl->isValid;
+}
+
+const std::vector<std::shared_ptr<TestFixture::ExperimentValue>>& Factory::getExperimentValues()
+{
+	this->cacheMetadata();
+	return this->pimpl->experimentValues;
+}
+
+double Factory::getExperimentValueResultScale()
+{
+	this->cacheMetadata();
+	return this->pimpl->experimentValueResultScale;
+}
+
+TestFixture::FixtureLifetime Factory::getFixtureLifetime()
+{
+	this->cacheMetadata();
+	return this->pimpl->fixtureLifetime;
+}
+
+bool Factory::getReportsBytes()
+{
+	this->cacheMetadata();
+	return this->pimpl->reportsBytes;
+}
+
+bool Factory::getReportsItems()
+{
+	this->cacheMetadata();
+	return this->pimpl->reportsItems;
+}
+
+const std::vector<std::string>& Factory::getUserDefinedMeasurementNames()
+{
+	this->cacheMetadata();
+	return this->pimpl->userDefinedMeasurementNames;
+}
+
+const std::vector<std::string>& Factory::getUserDefinedMeasurementFields()
+{
+	this->cacheMetadata();
+	return this->pimpl->userDefinedMeasurementFields;
+}
+
+void Factory::cacheMetadata()
+{
+	if(this->pimpl->isCached == true)
+	{
+		return;
+	}
+
+	this->pimpl->isCached = true;
+
+	const auto fixture = this->Create();
+
+	if(fixture == nullptr)
+	{
+		return;
+	}
+
+	this->pimpl->experimentValues = fixture->getExperimentValues();
+	this->pimpl->experimentValueResultScale = fixture->getExperimentValueResultScale();
+	this->pimpl->fixtureLifetime = fixture->getFixtureLifetime();
+
+	const TestFixture::ExperimentValue noProblemSpace(static_cast<int64_t>(TestFixture::Constants::NoProblemSpaceValue));
+
+	if(this->pimpl->experimentValues.empty() == true)
+	{
+		this->pimpl->reportsBytes = (fixture->getBytesPerIteration(&noProblemSpace) > 0);
+		this->pimpl->reportsItems = (fixture->getItemsPerIteration(&noProblemSpace) > 0);
+	}
+
+	for(const auto& i : this->pimpl->experimentValues)
+	{
+		this->pimpl->reportsBytes = this->pimpl->reportsBytes || (fixture->getBytesPerIteration(i.get()) > 0);
+		this->pimpl->reportsItems = this->pimpl->reportsItems || (fixture->getItemsPerIteration(i.get()) > 0);
+	}
+
+	for(const auto& udm : fixture->getUserDefinedMeasurements())
+	{
+		this->pimpl->userDefinedMeasurementNames.emplace_back(udm->getName());
+
+		for(const auto& aggDesc : udm->getAggregationInfo())
+		{
+			this->pimpl->userDefinedMeasurementFields.emplace_back(udm->getName() + std::string(" ") + aggDesc.first);
+		}
+	}
+
+	this->pimpl->isValid = true;
+}
@@ -0,0 +1,342 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Filter.h>
+#include <celero/PimplImpl.h>
+#include <celero/TestFixture.h>
+
+#include <iostream>
+#include <regex>
+#include <vector>
+
+using namespace celero;
+
+///
+/// Match a whole string against a glob where '*' matches any run of characters and '?' matches any one character.
+///
+static bool GlobMatch(const char* pattern, const char* x)
+{
+	const char* star = nullptr;
+	const char* resume = nullptr;
+
+	while(*x != '\0')
+	{
+		if(*pattern == '?' || *pattern == *x)
+		{
+			++pattern;
+			++x;
+		}
+		else if(*pattern == '*')
+		{
+			star = pattern++;
+			resume = x;
+		}
+		else if(star != nullptr)
+		{
+			// Let the last '*' absorb one more character and retry.
+			pattern = star + 1;
+			x = ++resume;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	while(*pattern == '*')
+	{
+		++pattern;
+	}
+
+	return *pattern == '\0';
+}
+
+///
+/// \class Impl
+///
+class celero::Filter::Impl
+{
+public:
+	///
+	/// One side of a pattern, matching either the experiment name or the problem space.
+	///
+	struct Matcher
+	{
+		bool matches(const std::string& x) const
+		{
+			if(this->any == true)
+			{
+				return true;
+			}
+
+			return (this->isRegex == true) ? std::regex_match(x, this->regex) : GlobMatch(this->glob.c_str(), x.c_str());
+		}
+
+		std::string glob;
+		std::regex regex;
+		bool isRegex{false};
+
+		/// Patterns without a problem space part accept every problem space.
+		bool any{false};
+	};
+
+	struct Pattern
+	{
+		Matcher name;
+		Matcher problemSpace;
+	};
+
+	static bool Parse(const std::string& x, Pattern& pattern)
+	{
+		const std::string regexPrefix{"regex:"};
+		const auto isRegex = (x.compare(0, regexPrefix.size(), regexPrefix) == 0);
+		const auto text = isRegex ? x.substr(regexPrefix.size()) : x;
+		const auto slash = text.rfind('/');
+
+		pattern.name.isRegex = isRegex;
+		pattern.name.glob = text.substr(0, slash);
+		pattern.problemSpace.isRegex = isRegex;
+		pattern.problemSpace.any = (slash == std::string::npos);
+		pattern.problemSpace.glob = (slash == std::string::npos) ? std::string() : text.substr(slash + 1);
+
+		if(isRegex == true)
+		{
+			try
+			{
+				pattern.name.regex = std::regex(pattern.name.glob);
+
+				if(pattern.problemSpace.any == false)
+				{
+					pattern.problemSpace.regex = std::regex(pattern.problemSpace.glob);
+				}
+			}
+			catch(const std::regex_error& e)
+			{
+				std::cerr << "ERROR: Celero filter \"" << x << "\" is not a valid regular expression: " << e.what() << std::endl;
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static std::string ProblemSpaceName(const TestFixture::ExperimentValue& x)
+	{
+		if(x.Parameters.empty() == false)
+		{
+			return x.getParameterString();
+		}
+
+		if(x.Value == static_cast<int64_t>(TestFixture::Constants::NoProblemSpaceValue))
+		{
+			return "Null";
+		}
+
+		return std::to_string(x.Value);
+	}
+
+	std::vector<Pattern> includes;
+	std::vector<Pattern> excludes;
+};
+
+Filter::Filter() : pimpl()
+{
+}
+
+Filter::~Filter()
+{
+}
+
+Filter& Filter::Instance()
+{
+	static Filter singleton;
+	return singleton;
+}
+
+bool Filter::addInclude(const std::string& x)
+{
+	Impl::Pattern pattern;
+
+	if(Impl::Parse(x, pattern) == false)
+	{
+		return false;
+	}
+
+	this->pimpl->includes.push_back(pattern);
+	return true;
+}
+
+bool Filter::addExclude(const std::string& x)
+{
+	Impl::Pattern pattern;
+
+	if(Impl::Parse(x, pattern) == false)
+	{
+		return false;
+	}
+
+	this->pimpl->excludes.push_back(pattern);
+	return true;
+}
+
+void Filter::clear()
+{
+	this->pimpl->includes.clear();
+	this->pimpl->excludes.clear();
+}
+
+bool Filter::isActive() const
+{
+	return (this->pimpl->includes.empty() == false) || (this->pimpl->excludes.empty() == false);
+}
+
+bool Filter::matches(const std::string& group, const std::string& experiment) const
+{
+	const auto name = group + "." + experiment;
+
+	auto included = this->pimpl->includes.empty();
+
+	for(const auto& i : this->pimpl->includes)
+	{
+		included = included || i.name.matches(name);
+	}
+
+	// Only an exclusion of every problem space rules out the experiment by name alone.
+	for(const auto& i : this->pimpl->excludes)
+	{
+		included = included && ((i.problemSpace.any == false) || (i.name.matches(name) == false));
+	}
+
+	return included;
+}
+
+bool Filter::matches(const std::string& group, const std::string& experiment, int64_t problemSpaceValue) const
+{
+	return this->matches(group, experiment, TestFixture::ExperimentValue(problemSpaceValue));
+}
+
+bool Filter::matches(const std::string& group, const std::string& experiment, const TestFixture::ExperimentValue& problemSpaceValue) const
+{
+	const auto name = group + "." + experiment;
+	const auto problemSpace = Impl::ProblemSpaceName(problemSpaceValue);
+
+	auto included = this->pimpl->includes.empty();
+
+	for(const auto& i : this->pimpl->includes)
+	{
+		included = included || (i.name.matches(name) && i.problemSpace.matches(problemSpace));
+	}
+
+	for(const auto& i : this->pimpl->excludes)
+	{
+		included = included && ((i.name.matches(name) && i.problemSpace.matches(problemSpace)) == false);
+	}
+
+	return included;
+}
+
+bool Filter::matches(std::shared_ptr<Experiment> x) const
+{
+	if(x == nullptr)
+	{
+		return false;
+	}
+
+	const auto bmark = x->getBenchmark();
+
+	if(this->isActive() == false || bmark == nullptr)
+	{
+		return true;
+	}
+
+	if(x->getIsBaselineCase() == true)
+	{
+		return this->matches(bmark);
+	}
+
+	return this->matches(bmark->getName(), x->getName());
+}
+
+bool Filter::matches(std::shared_ptr<Experiment> x, int64_t problemSpaceValue) const
+{
+	return this->matches(x, TestFixture::ExperimentValue(problemSpaceValue));
+}
+
+bool Filter::matches(std::shared_ptr<Experiment> x, const TestFixture::ExperimentValue& problemSpaceValue) const
+{
+	if(x == nullptr)
+	{
+		return false;
+	}
+
+	const auto bmark = x->getBenchmark();
+
+	if(this->isActive() == false || bmark == nullptr)
+	{
+		return true;
+	}
+
+	if(this->matches(bmark->getName(), x->getName(), problemSpaceValue) == true)
+	{
+		return true;
+	}
+
+	// A baseline problem space is needed whenever a selected experiment will be compared against it.
+	if(x->getIsBaselineCase() == true)
+	{
+		for(size_t i = 0; i < bmark->getExperimentSize(); ++i)
+		{
+			if(this->matches(bmark->getName(), bmark->getExperiment(i)->getName(), problemSpaceValue) == true)
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool Filter::matches(std::shared_ptr<Benchmark> x) const
+{
+	if(x == nullptr)
+	{
+		return false;
+	}
+
+	if(this->isActive() == false)
+	{
+		return true;
+	}
+
+	const auto baseline = x->getBaseline();
+
+	if(baseline != nullptr && this->matches(x->getName(), baseline->getName()) == true)
+	{
+		return true;
+	}
+
+	for(size_t i = 0; i < x->getExperimentSize(); ++i)
+	{
+		if(this->matches(x->getName(), x->getExperiment(i)->getName()) == true)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,375 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Benchmark.h>
+#include <celero/JSON.h>
+#include <celero/PimplImpl.h>
+#include <celero/Timer.h>
+#include <celero/UserDefinedMeasurementCollector.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace celero;
+
+///
+/// Write a string as a quoted JSON string.
+///
+void JSONString(std::ostream& os, const std::string& x)
+{
+	os << '"';
+
+	for(const auto c : x)
+	{
+		switch(c)
+		{
+			case '"':
+				os << "\\\"";
+				break;
+			case '\\':
+				os << "\\\\";
+				break;
+			case '\n':
+				os << "\\n";
+				break;
+			case '\r':
+				os << "\\r";
+				break;
+			case '\t':
+				os << "\\t";
+				break;
+			default:
+				if(static_cast<unsigned char>(c) < 0x20)
+				{
+					os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+				}
+				else
+				{
+					os << c;
+				}
+				break;
+		}
+	}
+
+	os << '"';
+}
+
+///
+/// Write a floating point number.  JSON has no representation for NaN or infinity, so those are written as null.
+///
+void JSONNumber(std::ostream& os, double x)
+{
+	if(std::isfinite(x) == true)
+	{
+		os << x;
+	}
+	else
+	{
+		os << "null";
+	}
+}
+
+///
+/// Write the summary of a set of samples as a JSON object.
+///
+void JSONStatistics(std::ostream& os, const Statistics<int64_t>& x)
+{
+	os << "{\"size\":" << x.getSize();
+	os << ",\"min\":" << x.getMin();
+	os << ",\"mean\":";
+	JSONNumber(os, x.getMean());
+	os << ",\"max\":" << x.getMax();
+	os << ",\"variance\":";
+	JSONNumber(os, x.getVariance());
+	os << ",\"standardDeviation\":";
+	JSONNumber(os, x.getStandardDeviation());
+	os << ",\"skewness\":";
+	JSONNumber(os, x.getSkewness());
+	os << ",\"kurtosis\":";
+	JSONNumber(os, x.getKurtosis());
+	os << ",\"zScore\":";
+	JSONNumber(os, x.getZScore());
+	os << "}";
+}
+
+std::string JSONHostName()
+{
+#ifdef _WIN32
+	char name[MAX_COMPUTERNAME_LENGTH + 1] = {0};
+	DWORD size = sizeof(name);
+
+	if(GetComputerNameA(name, &size) != 0)
+	{
+		return std::string(name, size);
+	}
+#else
+	char name[256] = {0};
+
+	if(gethostname(name, sizeof(name) - 1) == 0)
+	{
+		return std::string(name);
+	}
+#endif
+
+	return std::string();
+}
+
+///
+/// \class Impl
+///
+class celero::JSON::Impl
+{
+public:
+	std::string fileName;
+
+	/// Each result, serialized once when it was added.
+	std::vector<std::string> results;
+};
+
+JSON::JSON() : pimpl()
+{
+}
+
+JSON::~JSON()
+{
+}
+
+JSON& JSON::Instance()
+{
+	static JSON singleton;
+	return singleton;
+}
+
+void JSON::Serialize(std::ostream& os, std::shared_ptr<celero::ExperimentResult> x)
+{
+	const auto experiment = x->getExperiment();
+	const auto precision = os.precision(std::numeric_limits<double>::max_digits10);
+
+	os << "{\"group\":";
+	JSONString(os, experiment->getBenchmark()->getName());
+	os << ",\"experiment\":";
+	JSONString(os, experiment->getName());
+	os << ",\"isBaseline\":" << (experiment->getIsBaselineCase() ? "true" : "false");
+	os << ",\"failure\":" << (x->getFailure() ? "true" : "false");
+	os << ",\"regression\":" << (x->getRegression() ? "true" : "false");
+
+	os << ",\"problemSpace\":{\"value\":" << x->getProblemSpaceValue();
+	os << ",\"scale\":";
+	JSONNumber(os, x->getProblemSpaceValueScale());
+	os << ",\"iterations\":" << x->getProblemSpaceIterations();
+
+	// Only multi-dimensional problem spaces have named parameters.
+	if(x->getProblemSpace() != nullptr && x->getProblemSpace()->Parameters.empty() == false)
+	{
+		auto first = true;
+		os << ",\"parameters\":{";
+
+		for(const auto& i : x->getProblemSpace()->Parameters)
+		{
+			os << (first ? "" : ",");
+			JSONString(os, i.first);
+			os << ":" << i.second;
+			first = false;
+		}
+
+		os << "}";
+	}
+
+	os << "}";
+
+	os << ",\"samples\":" << experiment->getSamples();
+	os << ",\"threads\":" << experiment->getThreads();
+	os << ",\"baselineTarget\":";
+	JSONNumber(os, experiment->getBaselineTarget());
+	os << ",\"baseline\":";
+	JSONNumber(os, x->getBaselineMeasurement());
+	os << ",\"usPerIteration\":";
+	JSONNumber(os, x->getUsPerCall());
+	os << ",\"iterationsPerSecond\":";
+	JSONNumber(os, x->getCallsPerSecond());
+	os << ",\"unitsPerSecond\":";
+	JSONNumber(os, x->getUnitsPerSecond());
+	os << ",\"bytesPerIteration\":" << x->getBytesPerIteration();
+	os << ",\"itemsPerIteration\":" << x->getItemsPerIteration();
+	os << ",\"bytesPerSecond\":";
+	JSONNumber(os, x->getBytesPerSecond());
+	os << ",\"itemsPerSecond\":";
+	JSONNumber(os, x->getItemsPerSecond());
+
+	if(x->getRegression() == true)
+	{
+		os << ",\"regressionReferenceUsPerIteration\":";
+		JSONNumber(os, x->getRegressionReference());
+	}
+
+	os << ",\"time\":";
+	JSONStatistics(os, x->getTimeStatistics());
+	os << ",\"ram\":";
+	JSONStatistics(os, x->getRAMStatistics());
+	os << ",\"warmup\":{\"first\":" << x->getWarmupFirstRunTime() << ",\"time\":";
+	JSONStatistics(os, x->getWarmupStatistics());
+	os << "}";
+
+	os << ",\"userDefined\":{";
+
+	const auto udmCollector = x->getUserDefinedMeasurements();
+
+	if(udmCollector != nullptr)
+	{
+		auto first = true;
+
+		for(const auto& entry : udmCollector->getAggregateValues())
+		{
+			if(first == false)
+			{
+				os << ",";
+			}
+
+			JSONString(os, entry.first);
+			os << ":";
+			JSONNumber(os, entry.second);
+			first = false;
+		}
+	}
+
+	os << "}}";
+	os.precision(precision);
+}
+
+void JSON::SerializeString(std::ostream& os, const std::string& x)
+{
+	JSONString(os, x);
+}
+
+void JSON::SerializeEnvironment(std::ostream& os)
+{
+	const auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+	char timestamp[32] = {0};
+	std::tm utc;
+
+#ifdef _WIN32
+	gmtime_s(&utc, &now);
+#else
+	gmtime_r(&now, &utc);
+#endif
+
+	std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", &utc);
+
+	os << "{\"timestamp\":";
+	JSONString(os, timestamp);
+	os << ",\"host\":";
+	JSONString(os, JSONHostName());
+
+	os << ",\"os\":";
+#if defined(_WIN32)
+	JSONString(os, "Windows");
+#elif defined(__APPLE__)
+	JSONString(os, "macOS");
+#elif defined(__linux__)
+	JSONString(os, "Linux");
+#elif defined(__FreeBSD__)
+	JSONString(os, "FreeBSD");
+#else
+	JSONString(os, "Unknown");
+#endif
+
+	os << ",\"compiler\":";
+#if defined(__clang__)
+	JSONString(os, std::string("Clang ") + __clang_version__);
+#elif defined(__GNUC__)
+	JSONString(os, std::string("GCC ") + __VERSION__);
+#elif defined(_MSC_VER)
+	JSONString(os, std::string("MSVC ") + std::to_string(_MSC_FULL_VER));
+#else
+	JSONString(os, "Unknown");
+#endif
+
+	os << ",\"build\":";
+#ifdef _DEBUG
+	JSONString(os, "Debug");
+#else
+	JSONString(os, "Release");
+#endif
+
+	os << ",\"hardwareConcurrency\":" << std::thread::hardware_concurrency();
+	os << ",\"timerResolutionUs\":";
+	JSONNumber(os, celero::timer::CachePerformanceFrequency(true));
+	os << "}";
+}
+
+void JSON::setFileName(const std::string& x)
+{
+	this->pimpl->fileName = x;
+}
+
+void JSON::add(std::shared_ptr<celero::ExperimentResult> x)
+{
+	if(x == nullptr || x->getExperiment() == nullptr)
+	{
+		return;
+	}
+
+	std::stringstream ss;
+	JSON::Serialize(ss, x);
+	this->pimpl->results.push_back(ss.str());
+}
+
+void JSON::save()
+{
+	if(this->pimpl->fileName.empty() == true)
+	{
+		return;
+	}
+
+	std::stringstream ss;
+	ss << "{\"environment\":";
+	JSON::SerializeEnvironment(ss);
+	ss << ",\n\"results\":[";
+
+	for(size_t i = 0; i < this->pimpl->results.size(); ++i)
+	{
+		ss << ((i == 0) ? "\n" : ",\n") << this->pimpl->results[i];
+	}
+
+	ss << "\n]}\n";
+
+	std::ofstream ofs;
+	ofs.open(this->pimpl->fileName, std::fstream::out | std::fstream::trunc);
+
+	if(ofs.is_open() == false)
+	{
+		std::cerr << "ERROR: Celero could not open JSON output file: \"" << this->pimpl->fileName << "\"." << std::endl;
+		return;
+	}
+
+	ofs << ss.str();
+}
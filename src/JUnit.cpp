@@ -24,26 +24,164 @@
 #include <celero/Utilities.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
 #include <map>
-#include <tuple>
+#include <sstream>
 #include <vector>
 
 using namespace celero;
 
+namespace
+{
+	///
+	/// Escape the characters which may not appear as-is in an XML attribute value.
+	///
+	std::string JUnitEscape(const std::string& x)
+	{
+		std::string escaped;
+		escaped.reserve(x.size());
+
+		for(const auto c : x)
+		{
+			switch(c)
+			{
+				case '&':
+					escaped += "&amp;";
+					break;
+				case '<':
+					escaped += "&lt;";
+					break;
+				case '>':
+					escaped += "&gt;";
+					break;
+				case '"':
+					escaped += "&quot;";
+					break;
+				case '\'':
+					escaped += "&apos;";
+					break;
+				default:
+					escaped += c;
+					break;
+			}
+		}
+
+		return escaped;
+	}
+} // namespace
+
 ///
 /// \struct celero::JUnit::Impl
 ///
 class celero::JUnit::Impl
 {
 public:
+	///
+	/// A testsuite whose testcases have already been rendered to XML.
+	///
+	struct Suite
+	{
+		std::string testCases;
+		uint64_t time{0};
+		size_t tests{0};
+		size_t failures{0};
+		size_t errors{0};
+	};
+
+	///
+	/// Render a single result as a testcase element, including its measurement properties.
+	///
+	void render(Suite& suite, std::shared_ptr<celero::ExperimentResult> x)
+	{
+		std::stringstream os;
+
+		const auto experiment = x->getExperiment();
+		const auto failure = x->getFailure();
+		const auto missedObjective =
+			(failure == false) && (experiment->getBaselineTarget() > 0.0) && (x->getBaselineMeasurement() > experiment->getBaselineTarget());
+		const auto regression = (failure == false) && (missedObjective == false) && (x->getRegression() == true);
+
+		suite.tests++;
+
+		if(failure == true)
+		{
+			suite.errors++;
+		}
+		else
+		{
+			suite.time += x->getRunTime();
+
+			if(missedObjective == true || regression == true)
+			{
+				suite.failures++;
+			}
+		}
+
+		os << "\t<testcase ";
+		os << "time=\"" << celero::timer::ConvertSystemTime(failure ? 0 : x->getRunTime()) << "\" ";
+		const auto parameters = x->getProblemSpaceParameters();
+		os << "name=\"" << JUnitEscape(experiment->getName()) << "#";
+		os << (parameters.empty() ? std::to_string(x->getProblemSpaceValue()) : JUnitEscape(parameters)) << "\">\n";
+
+		if(failure == false)
+		{
+			const auto& stats = x->getTimeStatistics();
+			const auto iterations = static_cast<double>(std::max(x->getProblemSpaceIterations(), uint64_t(1)));
+			const auto samples = stats.getSize();
+
+			// Half-width of the 95% confidence interval of the mean us/iteration, using the normal approximation.
+			const auto ci = (samples > 1) ? 1.96 * stats.getStandardDeviation() / std::sqrt(static_cast<double>(samples)) / iterations : 0.0;
+
+			os << "\t\t<properties>\n";
+			os << "\t\t\t<property name=\"usPerIteration\" value=\"" << x->getUsPerCall() << "\"/>\n";
+			os << "\t\t\t<property name=\"baseline\" value=\"" << x->getBaselineMeasurement() << "\"/>\n";
+			os << "\t\t\t<property name=\"meanUsPerIteration\" value=\"" << stats.getMean() / iterations << "\"/>\n";
+			os << "\t\t\t<property name=\"ci95UsPerIteration\" value=\"" << ci << "\"/>\n";
+			os << "\t\t\t<property name=\"samples\" value=\"" << samples << "\"/>\n";
+			os << "\t\t\t<property name=\"iterations\" value=\"" << x->getProblemSpaceIterations() << "\"/>\n";
+			os << "\t\t</properties>\n";
+		}
+
+		// Compare measured to objective
+		if(failure == true)
+		{
+			// Error
+			os << "\t\t<error type=\"exception\"/>\n";
+		}
+		else if(missedObjective == true)
+		{
+			// Failure
+			os << "\t\t<failure ";
+			os << "type=\"Performance objective not met.\" ";
+			os << "message=\"Measurement of " << x->getBaselineMeasurement() << " exceeds objective baseline of " << experiment->getBaselineTarget()
+			   << "\" ";
+			os << "/>\n";
+		}
+		else if(regression == true)
+		{
+			// Failure
+			os << "\t\t<failure ";
+			os << "type=\"Performance regression.\" ";
+			os << "message=\"Measurement of " << x->getUsPerCall() << " us/iteration exceeds archived mean of " << x->getRegressionReference()
+			   << " us/iteration\" ";
+			os << "/>\n";
+		}
+
+		os << "\t</testcase>\n";
+
+		suite.testCases += os.str();
+	}
+
 	std::string fileName;
 
-	/// Store the test case size, measured baseline, objective baseline, and total run time in seconds.
-	std::map<std::string, std::vector<std::shared_ptr<celero::ExperimentResult>>> results;
+	/// Testsuites by group name, each with its testcases already rendered.
+	std::map<std::string, Suite> suites;
 
-	double totalTime = {0.0};
+	/// True when results were added since the file was last written.
+	bool dirty{false};
 };
 
 JUnit& JUnit::Instance()
@@ -60,91 +198,64 @@ void JUnit::setFileName(const std::string& x)
 
 void JUnit::add(std::shared_ptr<celero::ExperimentResult> x)
 {
-	this->pimpl->results[x->getExperiment()->getBenchmark()->getName()].push_back(x);
-	this->save();
+	if(x == nullptr || x->getExperiment() == nullptr)
+	{
+		return;
+	}
+
+	this->pimpl->render(this->pimpl->suites[x->getExperiment()->getBenchmark()->getName()], x);
+	this->pimpl->dirty = true;
 }
 
 void JUnit::save()
 {
-	std::ofstream ofs;
-	ofs.open(this->pimpl->fileName);
-
-	if(ofs.is_open() == true)
+	if(this->pimpl->fileName.empty() == true || this->pimpl->dirty == false)
 	{
-		const auto os = &ofs;
+		return;
+	}
 
-		*os << "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>" << std::endl;
+	std::string document{"<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n"};
 
-		for(auto i : this->pimpl->results)
-		{
-			uint64_t testSuiteTime = 0;
-			size_t testSuiteFailures = 0;
-			size_t testSuiteErrors = 0;
+	// A single root element keeps the document well-formed when there are several suites.
+	document += "<testsuites>\n";
 
-			const auto runs = i.second;
+	for(const auto& i : this->pimpl->suites)
+	{
+		std::stringstream os;
+		os << "<testsuite errors=\"" << i.second.errors << "\" ";
+		os << "tests=\"" << i.second.tests << "\" ";
+		os << "time=\"" << celero::timer::ConvertSystemTime(i.second.time) << "\" ";
+		os << "failures=\"" << i.second.failures << "\" ";
+		os << "name=\"" << JUnitEscape(i.first) << "\">\n";
 
-			for(auto j : runs)
-			{
-				if(j->getFailure())
-				{
-					testSuiteErrors++;
-					continue;
-				}
-				else if((j->getExperiment()->getBaselineTarget() > 0.0) && (j->getBaselineMeasurement() > j->getExperiment()->getBaselineTarget()))
-				{
-					testSuiteFailures++;
-				}
-
-				testSuiteTime += j->getRunTime();
-			}
+		document += os.str();
+		document += i.second.testCases;
+		document += "</testsuite>\n";
+	}
 
-			*os << "<testsuite errors=\"" << testSuiteErrors << "\" ";
-			*os << "tests=\"" << i.second.size() << "\" ";
-			*os << "time=\"" << celero::timer::ConvertSystemTime(testSuiteTime) << "\" ";
-			*os << "failures=\"" << testSuiteFailures << "\" ";
-			*os << "name=\"" << i.first << "\">" << std::endl;
+	document += "</testsuites>\n";
 
-			for(auto j : runs)
-			{
-				*os << "\t<testcase ";
-				*os << "time=\"" << celero::timer::ConvertSystemTime(j->getFailure() ? 0 : j->getRunTime()) << "\" ";
-				*os << "name=\"" << j->getExperiment()->getName() << "#" << j->getProblemSpaceValue() << "\"";
-
-				// Compare measured to objective
-				if(j->getFailure())
-				{
-					// Error
-					*os << ">" << std::endl;
-
-					*os << "\t\t<error ";
-					*os << "type=\"exception\"";
-					*os << "/>" << std::endl;
-
-					*os << "\t</testcase>" << std::endl;
-				}
-				else if((j->getExperiment()->getBaselineTarget() > 0.0) && (j->getBaselineMeasurement() > j->getExperiment()->getBaselineTarget()))
-				{
-					// Failure
-					*os << ">" << std::endl;
-
-					*os << "\t\t<failure ";
-					*os << "type=\"Performance objective not met.\" ";
-					*os << "message=\"Measurement of " << j->getBaselineMeasurement() << " exceeds objective baseline of "
-						<< j->getExperiment()->getBaselineTarget() << "\" ";
-					*os << "/>" << std::endl;
-
-					*os << "\t</testcase>" << std::endl;
-				}
-				else
-				{
-					// Success
-					*os << "/>" << std::endl;
-				}
-			}
+	// Write to a temporary file first so a crash never leaves a truncated document behind.
+	const auto tempFileName = this->pimpl->fileName + ".tmp";
 
-			*os << "</testsuite>" << std::endl;
-		}
+	std::ofstream ofs;
+	ofs.open(tempFileName, std::fstream::out | std::fstream::binary | std::fstream::trunc);
 
-		ofs.close();
+	if(ofs.is_open() == false)
+	{
+		std::cerr << "ERROR: Celero could not open JUnit output file: \"" << tempFileName << "\"." << std::endl;
+		return;
 	}
+
+	ofs.write(document.data(), static_cast<std::streamsize>(document.size()));
+	ofs.close();
+
+	if(ofs.fail() == true || celero::impl::AtomicReplaceFile(tempFileName, this->pimpl->fileName) == false)
+	{
+		std::cerr << "ERROR: Celero could not write JUnit output file: \"" << this->pimpl->fileName << "\"." << std::endl;
+		std::remove(tempFileName.c_str());
+		return;
+	}
+
+	this->pimpl->dirty = false;
 }
@@ -0,0 +1,142 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/JSON.h>
+#include <celero/NDJSON.h>
+#include <celero/PimplImpl.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace celero;
+
+///
+/// \class Impl
+///
+class celero::NDJSON::Impl
+{
+public:
+	std::ostream* getStream()
+	{
+		if(this->useStdOut == true)
+		{
+			return &this->stdOut;
+		}
+
+		if(this->ofs.is_open() == true)
+		{
+			return &this->ofs;
+		}
+
+		return nullptr;
+	}
+
+	std::ofstream ofs;
+
+	/// Writes to standard output while std::cout is sent to standard error.
+	std::ostream stdOut{nullptr};
+
+	/// The buffer of std::cout before it was sent to standard error.
+	std::streambuf* consoleBuffer{nullptr};
+
+	/// The environment is identical for every line, so it is serialized once.
+	std::string environment;
+
+	bool useStdOut{false};
+};
+
+NDJSON::NDJSON() : pimpl()
+{
+}
+
+NDJSON::~NDJSON()
+{
+	this->closeFile();
+}
+
+NDJSON& NDJSON::Instance()
+{
+	static NDJSON singleton;
+	return singleton;
+}
+
+void NDJSON::setFileName(const std::string& x)
+{
+	this->closeFile();
+
+	if(x == "-")
+	{
+		// Anything else written to standard output, such as the console table, would corrupt the stream.  Send it to standard error.
+		this->pimpl->consoleBuffer = std::cout.rdbuf(std::cerr.rdbuf());
+		this->pimpl->stdOut.rdbuf(this->pimpl->consoleBuffer);
+		this->pimpl->useStdOut = true;
+	}
+	else
+	{
+		this->pimpl->ofs.open(x, std::fstream::out | std::fstream::trunc);
+
+		if(this->pimpl->ofs.is_open() == false)
+		{
+			std::cerr << "ERROR: Celero could not open NDJSON output file: \"" << x << "\"." << std::endl;
+		}
+	}
+
+	std::stringstream ss;
+	JSON::SerializeEnvironment(ss);
+	this->pimpl->environment = ss.str();
+}
+
+void NDJSON::add(std::shared_ptr<celero::ExperimentResult> x)
+{
+	auto os = this->pimpl->getStream();
+
+	if(os == nullptr || x == nullptr || x->getExperiment() == nullptr)
+	{
+		return;
+	}
+
+	std::stringstream ss;
+	JSON::Serialize(ss, x);
+
+	// Splice the environment in as the first member of the result object, and emit the whole line with a single write.
+	auto line = ss.str();
+	line.insert(1, "\"environment\":" + this->pimpl->environment + ",");
+	line += "\n";
+
+	os->write(line.data(), static_cast<std::streamsize>(line.size()));
+	os->flush();
+}
+
+void NDJSON::closeFile()
+{
+	if(this->pimpl->ofs.is_open() == true)
+	{
+		this->pimpl->ofs.close();
+	}
+
+	if(this->pimpl->consoleBuffer != nullptr)
+	{
+		this->pimpl->stdOut.flush();
+		std::cout.rdbuf(this->pimpl->consoleBuffer);
+		this->pimpl->stdOut.rdbuf(nullptr);
+		this->pimpl->consoleBuffer = nullptr;
+	}
+
+	this->pimpl->useStdOut = false;
+}
@@ -25,11 +25,8 @@
 #include <celero/Utilities.h>
 
 #include <algorithm>
-#include <chrono>
-#include <iomanip>
+#include <cstdio>
 #include <iostream>
-#include <sstream>
-#include <unordered_map>
 
 using namespace celero;
 
@@ -38,7 +35,8 @@ enum PrintConstants : size_t
 	ColumnSeperatorWidth = 3,
 	DoubleDecimals = 5,
 	NumberOfColumns = 9,
-	ColumnWidth = 15
+	ColumnWidth = 15,
+	ProgressBarWidth = 40
 };
 
 // Here, we demonstrate "worst-practices" my implementing a global variable.
@@ -47,240 +45,325 @@ enum PrintConstants : size_t
 size_t GlobalGroupNameColumnWidth(15);
 
 ///
-/// http://stackoverflow.com/questions/14765155/how-can-i-easily-format-my-data-table-in-c
-/// Center-aligns string within a field of width w. Pads with blank spaces to enforce alignment.
+/// Append formatted text to the output.  Formatting goes through a fixed stack buffer, so no temporary strings or streams are created.
 ///
-std::string PrintCenter(const std::string& s, const size_t w = PrintConstants::ColumnWidth)
+template <typename... Args>
+void PrintFormat(std::string& out, const char* format, Args... args)
 {
-	std::stringstream ss;
-	std::stringstream spaces;
-
-	// count excess room to pad
-	auto padding = w - s.size();
+	char text[128];
+	const auto length = std::snprintf(text, sizeof(text), format, args...);
 
-	for(size_t i = 0; i < padding / 2; ++i)
+	if(length > 0)
 	{
-		spaces << " ";
+		out.append(text, std::min(static_cast<size_t>(length), sizeof(text) - 1));
 	}
+}
+
+///
+/// Format a rate with the largest prefix that keeps the number at least one, such as "1.25 GB/s" or "1.16 GiB/s".
+///
+std::string FormatRate(double x, const char* unit, const bool binary)
+{
+	static const char* const DecimalPrefixes[] = {"", "k", "M", "G", "T", "P"};
+	static const char* const BinaryPrefixes[] = {"", "Ki", "Mi", "Gi", "Ti", "Pi"};
+	const auto base = binary ? 1024.0 : 1000.0;
 
-	// format with padding
-	ss << spaces.str() << s << spaces.str();
+	size_t prefix = 0;
 
-	// if odd #, add 1 space
-	if((padding > 0) && (padding % 2 != 0))
+	while(x >= base && prefix < 5)
 	{
-		ss << " ";
+		x /= base;
+		++prefix;
 	}
 
-	celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
-	ss << " | ";
-	return ss.str();
+	std::string out;
+	PrintFormat(out, "%.2f %s%s/s", x, binary ? BinaryPrefixes[prefix] : DecimalPrefixes[prefix], unit);
+	return out;
 }
 
 ///
 /// http://stackoverflow.com/questions/14765155/how-can-i-easily-format-my-data-table-in-c
-/// Convert double to string with specified number of places after the decimal and left padding.
+/// Center-aligns string within a field of width w. Pads with blank spaces to enforce alignment.
 ///
-std::string PrintColumn(const double x, const size_t decDigits = PrintConstants::DoubleDecimals, const size_t width = PrintConstants::ColumnWidth)
+void PrintCenter(std::string& out, const std::string& s, const size_t w = PrintConstants::ColumnWidth)
 {
-	std::stringstream ss;
-	ss << std::fixed << std::right;
-
-	// fill space around displayed #
-	ss.fill(' ');
+	// count excess room to pad
+	const auto padding = (w > s.size()) ? w - s.size() : size_t(0);
 
-	// set  width around displayed #
-	ss.width(width);
+	out.append(padding / 2, ' ');
+	out += s;
+	out.append(padding / 2, ' ');
 
-	// set # places after decimal
-	ss.precision(decDigits);
-	ss << x;
+	// if odd #, add 1 space
+	if((padding > 0) && (padding % 2 != 0))
+	{
+		out += ' ';
+	}
 
-	celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
-	ss << " | ";
-	return ss.str();
+	out += " | ";
 }
 
 ///
 /// http://stackoverflow.com/questions/14765155/how-can-i-easily-format-my-data-table-in-c
-/// Convert double to string with specified number of places after the decimal.
+/// Convert double to string with specified number of places after the decimal and left padding.
 ///
-std::string PrintColumn(const int64_t x, const size_t width = PrintConstants::ColumnWidth)
+void PrintColumn(std::string& out, const double x, const size_t decDigits = PrintConstants::DoubleDecimals,
+				 const size_t width = PrintConstants::ColumnWidth)
 {
-	std::stringstream ss;
-	ss << std::fixed;
-
-	// fill space around displayed #
-	ss.fill(' ');
-
-	// set  width around displayed #
-	ss.width(width);
-	ss << x;
-
-	celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
-	ss << " | ";
-	return ss.str();
+	PrintFormat(out, "%*.*f | ", static_cast<int>(width), static_cast<int>(decDigits), x);
 }
 
 ///
 /// http://stackoverflow.com/questions/14765155/how-can-i-easily-format-my-data-table-in-c
-/// Convert double to string with specified number of places after the decimal.
+/// Convert an integer to a right-aligned string.
 ///
-std::string PrintColumn(const uint64_t x, const size_t width = PrintConstants::ColumnWidth)
+void PrintColumn(std::string& out, const int64_t x, const size_t width = PrintConstants::ColumnWidth)
 {
-	std::stringstream ss;
-	ss << std::fixed;
-
-	// fill space around displayed #
-	ss.fill(' ');
-
-	// set  width around displayed #
-	ss.width(width);
-	ss << x;
-
-	celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
-	ss << " | ";
-	return ss.str();
+	PrintFormat(out, "%*lld | ", static_cast<int>(width), static_cast<long long>(x));
 }
 
 ///
 /// http://stackoverflow.com/questions/14765155/how-can-i-easily-format-my-data-table-in-c
-/// Convert double to string with specified number of places after the decimal.
+/// Convert an unsigned integer to a right-aligned string.
 ///
-std::string PrintStrColumnAligned(const std::string& x, const size_t width = PrintConstants::ColumnWidth, bool alignLeft = true)
+void PrintColumn(std::string& out, const uint64_t x, const size_t width = PrintConstants::ColumnWidth)
 {
-	std::stringstream ss;
-	ss << std::fixed << (alignLeft ? std::left : std::right);
-
-	// fill space around displayed #
-	ss.fill(' ');
+	PrintFormat(out, "%*llu | ", static_cast<int>(width), static_cast<unsigned long long>(x));
+}
 
-	// set width around displayed #
-	ss.width(width);
+///
+/// http://stackoverflow.com/questions/14765155/how-can-i-easily-format-my-data-table-in-c
+/// Pad or truncate a string to the column width.
+///
+void PrintStrColumnAligned(std::string& out, const std::string& x, const size_t width = PrintConstants::ColumnWidth, bool alignLeft = true)
+{
+	const auto length = std::min(x.length(), width);
 
-	if(x.length() > width)
+	if(alignLeft == false)
 	{
-		// Truncate
-		std::string xTrunc = x;
-		xTrunc = xTrunc.substr(0, width);
-		ss << xTrunc;
+		out.append(width - length, ' ');
 	}
-	else
+
+	// Truncate
+	out.append(x, 0, length);
+
+	if(alignLeft == true)
 	{
-		ss << x;
+		out.append(width - length, ' ');
 	}
 
-	celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
-	ss << " | ";
-	return ss.str();
+	out += " | ";
 }
 
-std::string PrintColumn(const std::string& x, const size_t width = PrintConstants::ColumnWidth)
+void PrintColumn(std::string& out, const std::string& x, const size_t width = PrintConstants::ColumnWidth)
 {
-	return PrintStrColumnAligned(x, width);
+	PrintStrColumnAligned(out, x, width);
 }
 
-std::string PrintColumnRight(const std::string& x, const size_t width = PrintConstants::ColumnWidth)
+void PrintColumnRight(std::string& out, const std::string& x, const size_t width = PrintConstants::ColumnWidth)
 {
-	return PrintStrColumnAligned(x, width, false);
+	PrintStrColumnAligned(out, x, width, false);
 }
 
-std::string PrintHRule(const size_t additionalColumns = 0)
+void PrintHRule(std::string& out, const size_t additionalColumns = 0)
 {
-	celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
-
-	std::stringstream ss;
-	std::string column{":"};
-	std::string groupColumn{":"};
+	out += "|:";
+	out.append(GlobalGroupNameColumnWidth > 1 ? GlobalGroupNameColumnWidth - 1 : 0, '-');
+	out += ":|";
 
-	while(column.length() < PrintConstants::ColumnWidth)
+	for(size_t i = 0; i < PrintConstants::NumberOfColumns + additionalColumns - 1; ++i)
 	{
-		column += "-";
+		out += ':';
+		out.append(PrintConstants::ColumnWidth, '-');
+		out += ":|";
 	}
 
-	while(groupColumn.length() < GlobalGroupNameColumnWidth)
+	out += "\n";
+}
+
+namespace celero
+{
+	void Printer::color(celero::console::ConsoleColor x)
 	{
-		groupColumn += "-";
+#ifdef _WIN32
+		// The Windows console API changes the color immediately, so the text before it must be written first.
+		this->write();
+		celero::console::SetConsoleColor(x);
+#else
+		this->buffer += celero::console::GetConsoleColorCode(x);
+#endif
 	}
 
-	std::string firstColumn = column + ":|";
-	groupColumn = groupColumn + ":|";
+	void Printer::write()
+	{
+		if(this->buffer.empty() == false)
+		{
+			std::cout.write(this->buffer.data(), static_cast<std::streamsize>(this->buffer.size()));
+			std::cout.flush();
+			this->buffer.clear();
+		}
+	}
 
-	column += "-:|";
+	void Printer::progressBar()
+	{
+		const auto total = std::max(this->progressTotal, this->progressExperiments);
+		const auto filled = (total > 0) ? (this->progressExperiments * PrintConstants::ProgressBarWidth) / total : size_t(0);
 
-	ss << "|" << groupColumn;
+		this->buffer += "\r[";
+		this->buffer.append(filled, '#');
+		this->buffer.append(PrintConstants::ProgressBarWidth - filled, '.');
+		PrintFormat(this->buffer, "] %zu/%zu experiments, %zu results", this->progressExperiments, total, this->progressResults);
 
-	for(size_t i = 0; i < PrintConstants::NumberOfColumns + additionalColumns - 1; ++i)
-	{
-		ss << column;
-	}
+		if(this->progressFailures > 0)
+		{
+			this->color(celero::console::ConsoleColor::Red);
+			PrintFormat(this->buffer, ", %zu failed", this->progressFailures);
+			this->color(celero::console::ConsoleColor::Default);
+		}
 
-	ss << std::endl;
+		if(this->progressRegressions > 0)
+		{
+			this->color(celero::console::ConsoleColor::Red);
+			PrintFormat(this->buffer, ", %zu regressed", this->progressRegressions);
+			this->color(celero::console::ConsoleColor::Default);
+		}
 
-	return ss.str();
-}
+		this->write();
+	}
 
-namespace celero
-{
 	void Printer::Console(const std::string& x)
 	{
-		std::cout << "Celero: " << x << std::endl;
+		this->buffer += "Celero: ";
+		this->buffer += x;
+		this->buffer += "\n";
+		this->write();
 	}
 
 	void Printer::TableBanner(const size_t groupNameLength)
 	{
 		GlobalGroupNameColumnWidth = groupNameLength;
 
-		celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
+		if(this->mode == Mode::Progress)
+		{
+			this->progressBar();
+			return;
+		}
+
+		this->color(celero::console::ConsoleColor::Default);
 
-		std::cout << "|" << PrintCenter("Group", GlobalGroupNameColumnWidth) << PrintCenter("Experiment") << PrintCenter("Prob. Space")
-				  << PrintCenter("Samples")
-				  << PrintCenter("Iterations") << PrintCenter("Baseline") << PrintCenter("us/Iteration") << PrintCenter("Iterations/sec")
-				  << PrintCenter("RAM (bytes)");
+		this->buffer += "|";
+		PrintCenter(this->buffer, "Group", GlobalGroupNameColumnWidth);
+		PrintCenter(this->buffer, "Experiment");
+		PrintCenter(this->buffer, "Prob. Space");
+		PrintCenter(this->buffer, "Samples");
+		PrintCenter(this->buffer, "Iterations");
+		PrintCenter(this->buffer, "Baseline");
+		PrintCenter(this->buffer, "us/Iteration");
+		PrintCenter(this->buffer, "Iterations/sec");
+		PrintCenter(this->buffer, "RAM (bytes)");
+
+		if(this->bytesColumn == true)
+		{
+			PrintCenter(this->buffer, "Bytes/sec");
+		}
+
+		if(this->itemsColumn == true)
+		{
+			PrintCenter(this->buffer, "Items/sec");
+		}
 
 		for(size_t i = PrintConstants::NumberOfColumns; i < this->columnWidths.size(); ++i)
 		{
-			std::cout << PrintCenter(this->userDefinedColumns[i - PrintConstants::NumberOfColumns], this->columnWidths[i]);
+			PrintCenter(this->buffer, this->userDefinedColumns[i - PrintConstants::NumberOfColumns], this->columnWidths[i]);
 		}
 
-		std::cout << "\n";
-		std::cout << PrintHRule(this->userDefinedColumns.size());
+		this->buffer += "\n";
+		PrintHRule(this->buffer, this->userDefinedColumns.size() + (this->bytesColumn ? 1 : 0) + (this->itemsColumn ? 1 : 0));
+		this->write();
 	}
 
 	void Printer::TableRowExperimentHeader(Experiment* x)
 	{
-		celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
-		std::cout << "|" << PrintColumn(x->getBenchmark()->getName(), GlobalGroupNameColumnWidth) << PrintColumn(x->getName());
+		if(this->mode == Mode::Progress)
+		{
+			return;
+		}
+
+		// Start a new row.  Nothing is written until the row is complete.
+		this->buffer.clear();
+		this->color(celero::console::ConsoleColor::Default);
+		this->buffer += "|";
+		PrintColumn(this->buffer, x->getBenchmark()->getName(), GlobalGroupNameColumnWidth);
+		PrintColumn(this->buffer, x->getName());
 	}
 
 	void Printer::TableRowFailure(const std::string& msg)
 	{
-		std::cout << PrintColumnRight("-") << PrintColumnRight("-") << PrintColumnRight("-");
+		if(this->mode == Mode::Progress)
+		{
+			this->progressFailures++;
+			this->progressBar();
+			return;
+		}
+
+		PrintColumnRight(this->buffer, "-");
+		PrintColumnRight(this->buffer, "-");
+		PrintColumnRight(this->buffer, "-");
+
+		if(this->bytesColumn == true)
+		{
+			PrintColumnRight(this->buffer, "-");
+		}
+
+		if(this->itemsColumn == true)
+		{
+			PrintColumnRight(this->buffer, "-");
+		}
 
 		for(size_t i = PrintConstants::NumberOfColumns; i < this->columnWidths.size(); ++i)
 		{
-			std::cout << PrintColumnRight("-", this->columnWidths[i]);
+			PrintColumnRight(this->buffer, "-", this->columnWidths[i]);
 		}
 
-		celero::console::SetConsoleColor(celero::console::ConsoleColor::Red);
-		std::cout << msg << std::endl;
-		celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
+		this->color(celero::console::ConsoleColor::Red);
+		this->buffer += msg;
+		this->color(celero::console::ConsoleColor::Default);
+		this->buffer += "\n";
+		this->write();
 	}
 
 	void Printer::TableRowProblemSpaceHeader(std::shared_ptr<celero::ExperimentResult> x)
 	{
-		celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
+		if(this->mode == Mode::Progress)
+		{
+			return;
+		}
+
+		const auto ps = x->getProblemSpace();
+
+		if(ps != nullptr && ps->Parameters.empty() == false)
+		{
+			// Only the values fit in the column; the axis names are in the result table and JSON output.
+			std::string values;
 
-		if(x->getProblemSpaceValue() == static_cast<int64_t>(TestFixture::Constants::NoProblemSpaceValue))
+			for(const auto& i : ps->Parameters)
+			{
+				values += (values.empty() ? "" : ";") + std::to_string(i.second);
+			}
+
+			PrintColumnRight(this->buffer, values);
+		}
+		else if(x->getProblemSpaceValue() == static_cast<int64_t>(TestFixture::Constants::NoProblemSpaceValue))
 		{
-			std::cout << PrintColumnRight("Null");
+			PrintColumnRight(this->buffer, "Null");
 		}
 		else
 		{
-			std::cout << PrintColumn(x->getProblemSpaceValue());
+			PrintColumn(this->buffer, x->getProblemSpaceValue());
 		}
 
-		std::cout << PrintColumn(x->getExperiment()->getSamples()) << PrintColumn(x->getProblemSpaceIterations());
+		PrintColumn(this->buffer, x->getExperiment()->getSamples());
+		PrintColumn(this->buffer, x->getProblemSpaceIterations());
 	}
 
 	void Printer::TableRowHeader(std::shared_ptr<celero::ExperimentResult> x)
@@ -291,12 +374,23 @@ namespace celero
 
 	void Printer::TableResult(std::shared_ptr<celero::ExperimentResult> x)
 	{
-		celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
+		if(this->mode == Mode::Progress)
+		{
+			this->progressResults++;
+			this->progressRegressions += (x->getRegression() == true) ? 1 : 0;
+			this->progressBar();
+			return;
+		}
 
 		celero::console::ConsoleColor temp_color;
 
+		// Slower than archived history
+		if(x->getRegression() == true)
+		{
+			temp_color = celero::console::ConsoleColor::Red;
+		}
 		// Slower than Baseline
-		if(x->getBaselineMeasurement() > 1.0)
+		else if(x->getBaselineMeasurement() > 1.0)
 		{
 			temp_color = celero::console::ConsoleColor::Yellow;
 		}
@@ -309,48 +403,73 @@ namespace celero
 			temp_color = celero::console::ConsoleColor::Cyan;
 		}
 
-		celero::console::SetConsoleColor(temp_color);
-		std::cout << PrintColumn(x->getBaselineMeasurement());
-		celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
+		this->color(temp_color);
+		PrintColumn(this->buffer, x->getBaselineMeasurement());
+		PrintColumn(this->buffer, x->getUsPerCall());
+		PrintColumn(this->buffer, x->getCallsPerSecond(), 2);
+		PrintColumn(this->buffer, x->getRAM());
 
-		celero::console::SetConsoleColor(temp_color);
-		std::cout << PrintColumn(x->getUsPerCall());
-		celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
+		if(this->bytesColumn == true)
+		{
+			PrintColumnRight(this->buffer, (x->getBytesPerSecond() > 0.0) ? FormatRate(x->getBytesPerSecond(), "B", this->binaryUnits) : "---");
+		}
 
-		celero::console::SetConsoleColor(temp_color);
-		std::cout << PrintColumn(x->getCallsPerSecond(), 2);
-		celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
+		// Items are always scaled by powers of 1000.
+		if(this->itemsColumn == true)
+		{
+			PrintColumnRight(this->buffer, (x->getItemsPerSecond() > 0.0) ? FormatRate(x->getItemsPerSecond(), "items", false) : "---");
+		}
 
-		celero::console::SetConsoleColor(temp_color);
-		std::cout << PrintColumn(x->getRAM());
-		celero::console::SetConsoleColor(celero::console::ConsoleColor::Default);
+		this->color(celero::console::ConsoleColor::Default);
 
-		std::unordered_map<std::string, double> udmValues;
+		static const std::vector<std::pair<std::string, double>> NoUserDefinedValues;
 
-		auto udmCollector = x->getUserDefinedMeasurements();
-		if(udmCollector != nullptr)
-		{
-			for(const auto& entry : udmCollector->getAggregateValues())
-			{
-				udmValues[entry.first] = entry.second;
-			}
-		}
+		// The aggregates are sorted by name.
+		const auto udmCollector = x->getUserDefinedMeasurements();
+		const auto& udmValues = (udmCollector != nullptr) ? udmCollector->getAggregateValues() : NoUserDefinedValues;
 
 		for(size_t i = 0; i < this->userDefinedColumns.size(); ++i)
 		{
-			const auto& fieldName = this->userDefinedColumns[i];
+			const auto found = std::lower_bound(std::begin(udmValues), std::end(udmValues), this->userDefinedColumns[i],
+												[](const std::pair<std::string, double>& lhs, const std::string& rhs) { return lhs.first < rhs; });
 
-			if(udmValues.find(fieldName) == udmValues.end())
+			if(found == std::end(udmValues) || found->first != this->userDefinedColumns[i])
 			{
-				std::cout << PrintCenter("---", this->columnWidths[i + PrintConstants::NumberOfColumns]);
+				PrintCenter(this->buffer, "---", this->columnWidths[i + PrintConstants::NumberOfColumns]);
 			}
 			else
 			{
-				std::cout << PrintColumn(udmValues.at(fieldName), 2, this->columnWidths[i + PrintConstants::NumberOfColumns]);
+				PrintColumn(this->buffer, found->second, 2, this->columnWidths[i + PrintConstants::NumberOfColumns]);
 			}
 		}
 
-		std::cout << "\n";
+		if(x->getRegression() == true)
+		{
+			this->color(celero::console::ConsoleColor::Red);
+			PrintFormat(this->buffer, "Regression: +%.1f%% vs. archive", (x->getUsPerCall() / x->getRegressionReference() - 1.0) * 100.0);
+			this->color(celero::console::ConsoleColor::Default);
+		}
+
+		this->buffer += "\n";
+		this->write();
+	}
+
+	void Printer::ExperimentComplete(std::shared_ptr<celero::Experiment>)
+	{
+		if(this->mode == Mode::Progress)
+		{
+			this->progressExperiments++;
+			this->progressBar();
+		}
+	}
+
+	void Printer::ProgressComplete()
+	{
+		if(this->mode == Mode::Progress)
+		{
+			this->buffer += "\n";
+			this->write();
+		}
 	}
 
 	void Printer::initialize(std::vector<std::string> userDefinedColumnsIn)
@@ -366,4 +485,25 @@ namespace celero
 		}
 	}
 
+	void Printer::setMode(Mode x)
+	{
+		this->mode = x;
+	}
+
+	void Printer::setThroughputColumns(bool bytes, bool items)
+	{
+		this->bytesColumn = bytes;
+		this->itemsColumn = items;
+	}
+
+	void Printer::setBinaryUnits(bool x)
+	{
+		this->binaryUnits = x;
+	}
+
+	void Printer::setProgressTotal(size_t x)
+	{
+		this->progressTotal = x;
+	}
+
 } // namespace celero
@@ -0,0 +1,161 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Pimpl.h>
+#include <celero/PimplImpl.h>
+#include <celero/ProblemSpace.h>
+
+#include <algorithm>
+#include <utility>
+
+using namespace celero;
+
+///
+/// \class Impl
+///
+class celero::ProblemSpace::Impl
+{
+public:
+	std::vector<std::pair<std::string, std::vector<int64_t>>> axes;
+	int64_t iterations{0};
+};
+
+ProblemSpace::ProblemSpace() : pimpl()
+{
+}
+
+ProblemSpace::~ProblemSpace()
+{
+}
+
+ProblemSpace& ProblemSpace::axis(const std::string& name, const std::vector<int64_t>& values)
+{
+	const auto found = std::find_if(std::begin(this->pimpl->axes), std::end(this->pimpl->axes),
+									[&name](const std::pair<std::string, std::vector<int64_t>>& x) { return x.first == name; });
+
+	if(found != std::end(this->pimpl->axes))
+	{
+		found->second = values;
+	}
+	else
+	{
+		this->pimpl->axes.emplace_back(name, values);
+	}
+
+	return *this;
+}
+
+ProblemSpace& ProblemSpace::range(const std::string& name, int64_t first, int64_t last, int64_t multiplier)
+{
+	std::vector<int64_t> values;
+
+	for(auto i = first; i <= last;)
+	{
+		values.push_back(i);
+
+		// Stop before the next value passes last, checked before the arithmetic so it cannot overflow, or when a multiplier cannot make
+		// progress, such as from zero.
+		if(multiplier > 1)
+		{
+			if(i <= 0 || i > last / multiplier)
+			{
+				break;
+			}
+
+			i *= multiplier;
+		}
+		else
+		{
+			if(i == last)
+			{
+				break;
+			}
+
+			++i;
+		}
+	}
+
+	return this->axis(name, values);
+}
+
+ProblemSpace& ProblemSpace::iterations(int64_t x)
+{
+	this->pimpl->iterations = x;
+	return *this;
+}
+
+size_t ProblemSpace::size() const
+{
+	if(this->pimpl->axes.empty() == true)
+	{
+		return 0;
+	}
+
+	size_t x = 1;
+
+	for(const auto& i : this->pimpl->axes)
+	{
+		x *= i.second.size();
+	}
+
+	return x;
+}
+
+std::vector<std::shared_ptr<TestFixture::ExperimentValue>> ProblemSpace::build() const
+{
+	std::vector<std::shared_ptr<TestFixture::ExperimentValue>> values;
+
+	const auto count = this->size();
+
+	if(count == 0)
+	{
+		return values;
+	}
+
+	values.reserve(count);
+
+	// One index per axis, counted like the digits of a number whose last digit changes fastest.
+	std::vector<size_t> index(this->pimpl->axes.size(), 0);
+
+	for(size_t n = 0; n < count; ++n)
+	{
+		auto x = std::make_shared<TestFixture::ExperimentValue>();
+		x->Iterations = this->pimpl->iterations;
+		x->Parameters.reserve(this->pimpl->axes.size());
+
+		for(size_t i = 0; i < this->pimpl->axes.size(); ++i)
+		{
+			x->Parameters.emplace_back(this->pimpl->axes[i].first, this->pimpl->axes[i].second[index[i]]);
+		}
+
+		x->Value = x->Parameters.front().second;
+		values.push_back(x);
+
+		for(auto i = this->pimpl->axes.size(); i-- > 0;)
+		{
+			if(++index[i] < this->pimpl->axes[i].second.size())
+			{
+				break;
+			}
+
+			index[i] = 0;
+		}
+	}
+
+	return values;
+}
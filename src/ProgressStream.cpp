@@ -0,0 +1,349 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Benchmark.h>
+#include <celero/JSON.h>
+#include <celero/PimplImpl.h>
+#include <celero/ProgressStream.h>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+using namespace celero;
+
+///
+/// \class Impl
+///
+class celero::ProgressStream::Impl
+{
+public:
+	~Impl()
+	{
+		this->close();
+	}
+
+	void close()
+	{
+		if(this->fd >= 0 && this->ownsFd == true)
+		{
+#ifdef _WIN32
+			_close(this->fd);
+#else
+			::close(this->fd);
+#endif
+		}
+
+		this->fd = -1;
+		this->ownsFd = false;
+		this->isSocket = false;
+	}
+
+	///
+	/// Write one complete event line.  A reader that has gone away closes the stream rather than stopping the run.
+	///
+	void write(const std::string& x)
+	{
+#ifndef _WIN32
+		// Writing to a pipe or FIFO without a reader raises SIGPIPE, which would kill the process.  Block it on this thread for the
+		// duration of the write, and consume the signal the write raised, so EPIPE is seen as an ordinary error.
+		sigset_t pipeSignal;
+		sigemptyset(&pipeSignal);
+		sigaddset(&pipeSignal, SIGPIPE);
+
+		sigset_t previousMask;
+		pthread_sigmask(SIG_BLOCK, &pipeSignal, &previousMask);
+
+		sigset_t pending;
+		sigpending(&pending);
+		const auto wasPending = (sigismember(&pending, SIGPIPE) == 1);
+#endif
+
+		auto data = x.data();
+		auto remaining = x.size();
+
+		while(this->fd >= 0 && remaining > 0)
+		{
+#ifdef _WIN32
+			const auto written = static_cast<long long>(_write(this->fd, data, static_cast<unsigned int>(remaining)));
+#else
+			const auto written = (this->isSocket == true) ? static_cast<long long>(::send(this->fd, data, remaining, MSG_NOSIGNAL))
+														   : static_cast<long long>(::write(this->fd, data, remaining));
+#endif
+
+			if(written < 0)
+			{
+				if(errno == EINTR)
+				{
+					continue;
+				}
+
+				const auto error = errno;
+
+#ifndef _WIN32
+				if(error == EPIPE && wasPending == false)
+				{
+					sigpending(&pending);
+
+					if(sigismember(&pending, SIGPIPE) == 1)
+					{
+						int consumed = 0;
+						sigwait(&pipeSignal, &consumed);
+					}
+				}
+#endif
+
+				std::cerr << "WARNING: Celero progress stream closed: " << std::strerror(error) << std::endl;
+				this->close();
+				break;
+			}
+
+			data += written;
+			remaining -= static_cast<size_t>(written);
+		}
+
+#ifndef _WIN32
+		pthread_sigmask(SIG_SETMASK, &previousMask, nullptr);
+#endif
+	}
+
+	///
+	/// Begin an event line with the members every result event shares.
+	///
+	void beginResultEvent(std::stringstream& ss, const char* event, std::shared_ptr<celero::ExperimentResult> x) const
+	{
+		const auto experiment = x->getExperiment();
+
+		ss << "{\"event\":\"" << event << "\",\"timestamp\":" << this->now() << ",\"group\":";
+		JSON::SerializeString(ss, experiment->getBenchmark()->getName());
+		ss << ",\"experiment\":";
+		JSON::SerializeString(ss, experiment->getName());
+		ss << ",\"problemSpace\":" << x->getProblemSpaceValue();
+
+		const auto parameters = x->getProblemSpaceParameters();
+
+		if(parameters.empty() == false)
+		{
+			ss << ",\"parameters\":";
+			JSON::SerializeString(ss, parameters);
+		}
+	}
+
+	/// Return milliseconds since epoch.
+	uint64_t now() const
+	{
+		return static_cast<uint64_t>(
+			std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+	}
+
+	int fd{-1};
+	bool ownsFd{false};
+	bool isSocket{false};
+
+	/// The index of the next sample of the result being measured.
+	uint64_t sampleIndex{0};
+};
+
+ProgressStream::ProgressStream() : pimpl()
+{
+}
+
+ProgressStream::~ProgressStream()
+{
+}
+
+ProgressStream& ProgressStream::Instance()
+{
+	static ProgressStream singleton;
+	return singleton;
+}
+
+bool ProgressStream::open(const std::string& x)
+{
+	this->close();
+
+	const std::string fdPrefix{"fd:"};
+	const std::string unixPrefix{"unix:"};
+
+	if(x.compare(0, fdPrefix.size(), fdPrefix) == 0)
+	{
+		char* end = nullptr;
+		const auto fd = std::strtol(x.c_str() + fdPrefix.size(), &end, 10);
+
+		if(end != nullptr && *end == '\0' && fd >= 0)
+		{
+			this->pimpl->fd = static_cast<int>(fd);
+		}
+	}
+	else if(x.compare(0, unixPrefix.size(), unixPrefix) == 0)
+	{
+#ifdef _WIN32
+		std::cerr << "ERROR: Celero progress streams over Unix domain sockets are not supported on this platform." << std::endl;
+		return false;
+#else
+		const auto path = x.substr(unixPrefix.size());
+
+		sockaddr_un address;
+		std::memset(&address, 0, sizeof(address));
+		address.sun_family = AF_UNIX;
+
+		if(path.empty() == false && path.size() < sizeof(address.sun_path))
+		{
+			std::memcpy(address.sun_path, path.c_str(), path.size());
+
+			const auto fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+#ifdef SO_NOSIGPIPE
+			// Platforms without MSG_NOSIGNAL, such as macOS, suppress SIGPIPE on the socket instead.
+			if(fd >= 0)
+			{
+				const int on = 1;
+				::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+			}
+#endif
+
+			if(fd >= 0 && ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0)
+			{
+				this->pimpl->fd = fd;
+				this->pimpl->ownsFd = true;
+				this->pimpl->isSocket = true;
+			}
+			else if(fd >= 0)
+			{
+				::close(fd);
+			}
+		}
+#endif
+	}
+	else if(x.empty() == false)
+	{
+#ifdef _WIN32
+		this->pimpl->fd = _open(x.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+		this->pimpl->fd = ::open(x.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+		this->pimpl->ownsFd = true;
+	}
+
+	if(this->pimpl->fd < 0)
+	{
+		std::cerr << "ERROR: Celero could not open progress stream: \"" << x << "\"." << std::endl;
+		this->pimpl->close();
+		return false;
+	}
+
+	return true;
+}
+
+bool ProgressStream::isOpen() const
+{
+	return this->pimpl->fd >= 0;
+}
+
+void ProgressStream::close()
+{
+	this->pimpl->close();
+}
+
+void ProgressStream::resultStart(std::shared_ptr<celero::ExperimentResult> x)
+{
+	if(this->isOpen() == false || x == nullptr || x->getExperiment() == nullptr)
+	{
+		return;
+	}
+
+	this->pimpl->sampleIndex = 0;
+
+	std::stringstream ss;
+	this->pimpl->beginResultEvent(ss, "resultStart", x);
+	ss << ",\"samples\":" << x->getExperiment()->getSamples() << ",\"iterations\":" << x->getProblemSpaceIterations() << "}\n";
+	this->pimpl->write(ss.str());
+}
+
+void ProgressStream::sampleComplete(std::shared_ptr<celero::ExperimentResult> x, uint64_t sampleTime)
+{
+	if(this->isOpen() == false || x == nullptr || x->getExperiment() == nullptr)
+	{
+		return;
+	}
+
+	std::stringstream ss;
+	this->pimpl->beginResultEvent(ss, "sample", x);
+	ss << ",\"sample\":" << this->pimpl->sampleIndex++ << ",\"us\":" << sampleTime << "}\n";
+	this->pimpl->write(ss.str());
+}
+
+void ProgressStream::resultComplete(std::shared_ptr<celero::ExperimentResult> x)
+{
+	if(this->isOpen() == false || x == nullptr || x->getExperiment() == nullptr)
+	{
+		return;
+	}
+
+	std::stringstream ss;
+
+	if(x->getFailure() == true)
+	{
+		this->pimpl->beginResultEvent(ss, "failure", x);
+		ss << "}\n";
+	}
+	else
+	{
+		this->pimpl->beginResultEvent(ss, "resultComplete", x);
+		ss << ",\"samples\":" << x->getTimeStatistics().getSize() << ",\"usPerIteration\":" << x->getUsPerCall()
+		   << ",\"baseline\":" << x->getBaselineMeasurement() << ",\"regression\":" << (x->getRegression() ? "true" : "false") << "}\n";
+	}
+
+	this->pimpl->write(ss.str());
+}
+
+void ProgressStream::experimentComplete(std::shared_ptr<celero::Experiment> x)
+{
+	if(this->isOpen() == false || x == nullptr)
+	{
+		return;
+	}
+
+	std::stringstream ss;
+	ss << "{\"event\":\"experimentComplete\",\"timestamp\":" << this->pimpl->now() << ",\"group\":";
+	JSON::SerializeString(ss, x->getBenchmark()->getName());
+	ss << ",\"experiment\":";
+	JSON::SerializeString(ss, x->getName());
+	ss << "}\n";
+	this->pimpl->write(ss.str());
+}
@@ -0,0 +1,297 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Celero.h>
+#include <celero/Registrar.h>
+#include <celero/ThreadTestFixture.h>
+
+using namespace celero;
+
+///
+/// \struct RegistrarDefinition
+///
+/// Everything a Registrar collects.  Registered benchmarks share a constant copy of it.
+///
+struct celero::impl::RegistrarDefinition
+{
+	std::string groupName;
+	std::string benchmarkName;
+	bool isBaseline{false};
+	uint64_t samples{0};
+	uint64_t iterations{0};
+	uint64_t threads{1};
+	double target{-1};
+	std::vector<std::shared_ptr<TestFixture::ExperimentValue>> experimentValues;
+	Registrar::Function setUp;
+	Registrar::Function tearDown;
+	Registrar::CountFunction bytesPerIteration;
+	Registrar::CountFunction itemsPerIteration;
+	Registrar::Function benchmark;
+};
+
+namespace
+{
+	///
+	/// Runs the functions of a registered definition.  Derives from ThreadTestFixture for benchmarks with more than one thread.
+	///
+	template <class T>
+	class RegistrarFixture : public T
+	{
+	public:
+		explicit RegistrarFixture(std::shared_ptr<const impl::RegistrarDefinition> x) : T(), definition(std::move(x)), state(*this)
+		{
+		}
+
+		std::vector<std::shared_ptr<TestFixture::ExperimentValue>> getExperimentValues() const override
+		{
+			return this->definition->experimentValues;
+		}
+
+		int64_t getBytesPerIteration(const TestFixture::ExperimentValue* const x) const override
+		{
+			return (this->definition->bytesPerIteration != nullptr) ? this->definition->bytesPerIteration(x) : 0;
+		}
+
+		int64_t getItemsPerIteration(const TestFixture::ExperimentValue* const x) const override
+		{
+			return (this->definition->itemsPerIteration != nullptr) ? this->definition->itemsPerIteration(x) : 0;
+		}
+
+		void setUp(const TestFixture::ExperimentValue* const x) override
+		{
+			this->state.setExperimentValue(x);
+
+			if(this->definition->setUp != nullptr)
+			{
+				this->definition->setUp(this->state);
+			}
+		}
+
+		void tearDown() override
+		{
+			if(this->definition->tearDown != nullptr)
+			{
+				this->definition->tearDown(this->state);
+			}
+		}
+
+	protected:
+		void UserBenchmark() override
+		{
+			this->definition->benchmark(this->state);
+		}
+
+	private:
+		const std::shared_ptr<const impl::RegistrarDefinition> definition;
+		State state;
+	};
+
+	///
+	/// Creates the fixtures of a registered definition.
+	///
+	class RegistrarFactory : public Factory
+	{
+	public:
+		explicit RegistrarFactory(std::shared_ptr<const impl::RegistrarDefinition> x) : Factory(), definition(std::move(x))
+		{
+		}
+
+		std::shared_ptr<TestFixture> Create() override
+		{
+			if(this->definition->threads > 1)
+			{
+				return std::make_shared<RegistrarFixture<ThreadTestFixture>>(this->definition);
+			}
+
+			return std::make_shared<RegistrarFixture<TestFixture>>(this->definition);
+		}
+
+	private:
+		const std::shared_ptr<const impl::RegistrarDefinition> definition;
+	};
+} // namespace
+
+State::State(TestFixture& x) : fixture(x)
+{
+}
+
+const TestFixture::ExperimentValue* State::getExperimentValue() const
+{
+	return this->experimentValue;
+}
+
+int64_t State::getValue() const
+{
+	return (this->experimentValue != nullptr) ? this->experimentValue->Value : 0;
+}
+
+int64_t State::getParameter(const std::string& name, int64_t defaultValue) const
+{
+	return (this->experimentValue != nullptr) ? this->experimentValue->getParameter(name, defaultValue) : defaultValue;
+}
+
+void State::pauseTiming()
+{
+	this->fixture.pauseTiming();
+}
+
+void State::resumeTiming()
+{
+	this->fixture.resumeTiming();
+}
+
+void State::setIterationTime(uint64_t nanoseconds)
+{
+	this->fixture.setIterationTime(nanoseconds);
+}
+
+void State::setExperimentValue(const TestFixture::ExperimentValue* x)
+{
+	this->experimentValue = x;
+}
+
+Registrar::Registrar(const std::string& groupName, const std::string& benchmarkName)
+	: definition(std::make_shared<impl::RegistrarDefinition>())
+{
+	this->definition->groupName = groupName;
+	this->definition->benchmarkName = benchmarkName;
+}
+
+Registrar::~Registrar()
+{
+}
+
+Registrar::Registrar(const Registrar& other) : definition(std::make_shared<impl::RegistrarDefinition>(*other.definition))
+{
+}
+
+Registrar& Registrar::operator=(const Registrar& other)
+{
+	if(this != &other)
+	{
+		this->definition = std::make_shared<impl::RegistrarDefinition>(*other.definition);
+	}
+
+	return *this;
+}
+
+Registrar& Registrar::baseline()
+{
+	this->definition->isBaseline = true;
+	return *this;
+}
+
+Registrar& Registrar::samples(uint64_t x)
+{
+	this->definition->samples = x;
+	return *this;
+}
+
+Registrar& Registrar::iterations(uint64_t x)
+{
+	this->definition->iterations = x;
+	return *this;
+}
+
+Registrar& Registrar::threads(uint64_t x)
+{
+	this->definition->threads = x;
+	return *this;
+}
+
+Registrar& Registrar::target(double x)
+{
+	this->definition->target = x;
+	return *this;
+}
+
+Registrar& Registrar::problemSpace(const std::vector<std::shared_ptr<TestFixture::ExperimentValue>>& x)
+{
+	this->definition->experimentValues = x;
+	return *this;
+}
+
+Registrar& Registrar::problemSpace(const ProblemSpace& x)
+{
+	this->definition->experimentValues = x.build();
+	return *this;
+}
+
+Registrar& Registrar::setUp(Function x)
+{
+	this->definition->setUp = std::move(x);
+	return *this;
+}
+
+Registrar& Registrar::tearDown(Function x)
+{
+	this->definition->tearDown = std::move(x);
+	return *this;
+}
+
+Registrar& Registrar::bytesPerIteration(CountFunction x)
+{
+	this->definition->bytesPerIteration = std::move(x);
+	return *this;
+}
+
+Registrar& Registrar::bytesPerIteration(int64_t x)
+{
+	return this->bytesPerIteration([x](const TestFixture::ExperimentValue*) { return x; });
+}
+
+Registrar& Registrar::itemsPerIteration(CountFunction x)
+{
+	this->definition->itemsPerIteration = std::move(x);
+	return *this;
+}
+
+Registrar& Registrar::itemsPerIteration(int64_t x)
+{
+	return this->itemsPerIteration([x](const TestFixture::ExperimentValue*) { return x; });
+}
+
+std::shared_ptr<Benchmark> Registrar::run(Function x)
+{
+	if(x == nullptr)
+	{
+		return nullptr;
+	}
+
+	// Later changes to this Registrar must not reach the registered benchmark.
+	auto registered = std::make_shared<impl::RegistrarDefinition>(*this->definition);
+	registered->benchmark = std::move(x);
+
+	const auto groupName = registered->groupName;
+	const auto benchmarkName = registered->benchmarkName;
+	auto factory = std::make_shared<RegistrarFactory>(registered);
+
+	if(registered->isBaseline == true)
+	{
+		return celero::RegisterBaseline(groupName.c_str(), benchmarkName.c_str(), registered->samples, registered->iterations,
+										registered->threads, factory);
+	}
+
+	return celero::RegisterTest(groupName.c_str(), benchmarkName.c_str(), registered->samples, registered->iterations, registered->threads,
+								factory, registered->target);
+}
+
+Registrar celero::Register(const std::string& groupName, const std::string& benchmarkName)
+{
+	return Registrar(groupName, benchmarkName);
+}
@@ -0,0 +1,108 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Celero.h>
+#include <celero/Registration.h>
+
+#include <atomic>
+
+using namespace celero;
+
+namespace
+{
+	/// The most recent pending registration.  Constant-initialized, so it is ready before any registration is constructed.
+	std::atomic<const Registration*> Pending{nullptr};
+} // namespace
+
+Registration::Registration(Kind k, const char* group, const char* benchmark, uint64_t s, uint64_t i, uint64_t t, FactoryCreator f, double x)
+	: kind(k), groupName(group), benchmarkName(benchmark), samples(s), iterations(i), threads(t), createFactory(f), target(x)
+{
+	this->next = Pending.load(std::memory_order_relaxed);
+
+	while(Pending.compare_exchange_weak(this->next, this, std::memory_order_release, std::memory_order_relaxed) == false)
+	{
+	}
+}
+
+const Registration* Registration::TakePending()
+{
+	// Cheap enough to check on every use of the TestVector.
+	if(Pending.load(std::memory_order_relaxed) == nullptr)
+	{
+		return nullptr;
+	}
+
+	return Pending.exchange(nullptr, std::memory_order_acquire);
+}
+
+const Registration* Registration::getNext() const
+{
+	return this->next;
+}
+
+void Registration::apply() const
+{
+	if(this->kind == Kind::Baseline)
+	{
+		celero::RegisterBaseline(this->groupName, this->benchmarkName, this->samples, this->iterations, this->threads, this->createFactory());
+	}
+	else
+	{
+		celero::RegisterTest(this->groupName, this->benchmarkName, this->samples, this->iterations, this->threads, this->createFactory(),
+							 this->target);
+	}
+}
+
+std::string celero::impl::TemplateBenchmarkName(const char* benchmarkName, const char* typeList, size_t index)
+{
+	const std::string list{typeList};
+
+	// Skip the outer parentheses, then split on the commas which are not nested inside template arguments or parentheses.
+	size_t begin = (list.empty() == false && list.front() == '(') ? 1 : 0;
+	size_t position = 0;
+	int depth = 0;
+
+	for(size_t i = begin; i < list.size(); ++i)
+	{
+		const auto c = list[i];
+
+		if(c == '<' || c == '(' || c == '[' || c == '{')
+		{
+			++depth;
+		}
+		else if((c == '>' || c == ')' || c == ']' || c == '}') && depth > 0)
+		{
+			--depth;
+		}
+		else if((c == ',' && depth == 0) || (c == ')' && depth == 0))
+		{
+			if(position == index)
+			{
+				auto type = list.substr(begin, i - begin);
+				type.erase(0, type.find_first_not_of(' '));
+				type.erase(type.find_last_not_of(' ') + 1);
+				return std::string(benchmarkName) + "<" + type + ">";
+			}
+
+			++position;
+			begin = i + 1;
+		}
+	}
+
+	return std::string(benchmarkName) + "<" + std::to_string(index) + ">";
+}
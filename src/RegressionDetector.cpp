@@ -0,0 +1,152 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Archive.h>
+#include <celero/Benchmark.h>
+#include <celero/PimplImpl.h>
+#include <celero/RegressionDetector.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace celero;
+
+///
+/// \class Impl
+///
+class celero::RegressionDetector::Impl
+{
+public:
+	double threshold{10.0};
+	double sigma{3.0};
+	size_t window{10};
+	size_t regressionCount{0};
+	bool enabled{false};
+};
+
+RegressionDetector::RegressionDetector() : pimpl()
+{
+}
+
+RegressionDetector::~RegressionDetector()
+{
+}
+
+RegressionDetector& RegressionDetector::Instance()
+{
+	static RegressionDetector singleton;
+	return singleton;
+}
+
+void RegressionDetector::setEnabled(bool x)
+{
+	this->pimpl->enabled = x;
+}
+
+bool RegressionDetector::getEnabled() const
+{
+	return this->pimpl->enabled;
+}
+
+void RegressionDetector::setThreshold(double x)
+{
+	this->pimpl->threshold = x;
+}
+
+void RegressionDetector::setSigma(double x)
+{
+	this->pimpl->sigma = x;
+}
+
+void RegressionDetector::setWindow(size_t x)
+{
+	this->pimpl->window = x;
+}
+
+double RegressionDetector::check(double usPerCall, const std::vector<ArchiveHistoryPoint>& history) const
+{
+	const auto count = std::min(history.size(), std::max(this->pimpl->window, size_t(1)));
+
+	if(count == 0 || usPerCall <= 0.0)
+	{
+		return 0.0;
+	}
+
+	// Only the most recent runs take part, so an intentional change in the past does not hide a new regression.
+	const auto first = history.size() - count;
+
+	auto mean = 0.0;
+
+	for(size_t i = first; i < history.size(); ++i)
+	{
+		mean += history[i].UsPerCall;
+	}
+
+	mean /= static_cast<double>(count);
+
+	if(mean <= 0.0 || usPerCall <= mean * (1.0 + this->pimpl->threshold / 100.0))
+	{
+		return 0.0;
+	}
+
+	if(count > 1)
+	{
+		auto variance = 0.0;
+
+		for(size_t i = first; i < history.size(); ++i)
+		{
+			variance += (history[i].UsPerCall - mean) * (history[i].UsPerCall - mean);
+		}
+
+		const auto standardDeviation = std::sqrt(variance / static_cast<double>(count - 1));
+
+		if(usPerCall <= mean + this->pimpl->sigma * standardDeviation)
+		{
+			return 0.0;
+		}
+	}
+
+	return mean;
+}
+
+bool RegressionDetector::evaluate(std::shared_ptr<celero::ExperimentResult> x)
+{
+	if(this->pimpl->enabled == false || x == nullptr || x->getFailure() == true || x->getExperiment() == nullptr)
+	{
+		return false;
+	}
+
+	const auto experiment = x->getExperiment();
+	const auto history = Archive::Instance().getHistory(experiment->getBenchmark()->getName(), experiment->getName(), x->getProblemSpaceValue(),
+														x->getProblemSpaceParameters());
+	const auto reference = this->check(x->getUsPerCall(), history);
+
+	if(reference > 0.0)
+	{
+		x->setRegressionReference(reference);
+		this->pimpl->regressionCount++;
+		return true;
+	}
+
+	return false;
+}
+
+size_t RegressionDetector::getRegressionCount() const
+{
+	return this->pimpl->regressionCount;
+}
@@ -22,9 +22,12 @@
 #include <celero/ResultTable.h>
 #include <celero/UserDefinedMeasurementCollector.h>
 
+#include <algorithm>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
-#include <sstream>
+#include <set>
+#include <utility>
 
 using namespace celero;
 
@@ -34,6 +37,24 @@ using namespace celero;
 class celero::ResultTable::Impl
 {
 public:
+	///
+	/// A formatted row, waiting for the final set of user-defined columns to be known.
+	///
+	struct Row
+	{
+		/// The description columns before the problem space axes, each followed by a comma.
+		std::string description;
+
+		/// The named axes of a multi-dimensional problem space.
+		std::vector<std::pair<std::string, int64_t>> parameters;
+
+		/// Every other fixed column, each followed by a comma.
+		std::string cells;
+
+		/// User-defined measurement aggregates, sorted by name.
+		std::vector<std::pair<std::string, double>> userDefined;
+	};
+
 	Impl()
 	{
 	}
@@ -45,36 +66,171 @@ public:
 
 	void closeFile()
 	{
-		if(this->ofs.is_open() == true)
+		if(this->fileName.empty() == false)
 		{
-			this->ofs.close();
+			this->save();
+			this->fileName.clear();
+			this->rows.clear();
+			this->axes.clear();
+			this->fields.clear();
 		}
 	}
 
 	void setFileName(const std::string& x)
 	{
-		if(this->ofs.is_open() == true)
+		this->closeFile();
+		this->fileName = x;
+
+		// Create the file now so an unwritable path is reported before any benchmark runs.
+		std::ofstream ofs(x);
+
+		if(ofs.is_open() == false)
+		{
+			std::cerr << "ERROR: Celero could not open result table file: \"" << x << "\"." << std::endl;
+		}
+	}
+
+	void save()
+	{
+		std::string table{"Group,Experiment,Problem Space,"};
+
+		// Problem space axes
+		for(const auto& i : this->axes)
+		{
+			appendString(table, i);
+		}
+
+		table += "Samples,Iterations,Failure,";
+		table += "Baseline,us/Iteration,Iterations/sec,Bytes/sec,Items/sec,";
+		table += "T Min (us),T Mean (us),T Max (us),T Variance,T Standard Deviation,T Skewness,T Kurtosis,T Z Score,";
+		table += "R Min (us),R Mean (us),R Max (us),R Variance,R Standard Deviation,R Skewness,R Kurtosis,R Z Score,";
+		table += "W Samples,W First (us),W Mean (us),W Min (us),";
+
+		// User Defined Metrics
+		for(const auto& i : this->fields)
+		{
+			appendString(table, i);
+		}
+
+		table += "\n";
+
+		for(const auto& row : this->rows)
+		{
+			table += row.description;
+
+			for(const auto& i : this->axes)
+			{
+				const auto found = std::find_if(std::begin(row.parameters), std::end(row.parameters),
+												[&i](const std::pair<std::string, int64_t>& x) { return x.first == i; });
+
+				if(found != std::end(row.parameters))
+				{
+					appendNumber(table, found->second);
+				}
+				else
+				{
+					table += ",";
+				}
+			}
+
+			table += row.cells;
+
+			// Both lists are sorted, so a single merge pass fills each cell or leaves it empty.
+			auto value = std::begin(row.userDefined);
+
+			for(const auto& i : this->fields)
+			{
+				if(value != std::end(row.userDefined) && value->first == i)
+				{
+					appendNumber(table, value->second);
+					++value;
+				}
+				else
+				{
+					table += ",";
+				}
+			}
+
+			table += "\n";
+		}
+
+		std::ofstream ofs(this->fileName, std::fstream::out | std::fstream::binary | std::fstream::trunc);
+
+		if(ofs.is_open() == true)
+		{
+			ofs.write(table.data(), static_cast<std::streamsize>(table.size()));
+		}
+	}
+
+	///
+	/// Append a cell, quoting it if it contains a separator or quote.
+	///
+	static void appendString(std::string& x, const std::string& value)
+	{
+		if(value.find_first_of(",\"\n") == std::string::npos)
 		{
-			this->ofs.close();
+			x += value;
+		}
+		else
+		{
+			x += "\"";
+
+			for(const auto c : value)
+			{
+				x += c;
+
+				if(c == '"')
+				{
+					x += c;
+				}
+			}
+
+			x += "\"";
 		}
 
-		this->ofs.open(x);
+		x += ",";
+	}
+
+	static void appendNumber(std::string& x, double value)
+	{
+		// "%g" matches the default formatting of a std::ostream.
+		char buffer[32];
+		const auto length = std::snprintf(buffer, sizeof(buffer), "%g,", value);
+		x.append(buffer, static_cast<size_t>(length));
+	}
+
+	static void appendNumber(std::string& x, int64_t value)
+	{
+		x += std::to_string(value);
+		x += ",";
+	}
 
-		this->hasWrittenHeader = false;
+	static void appendNumber(std::string& x, uint64_t value)
+	{
+		x += std::to_string(value);
+		x += ",";
 	}
 
-	std::string format(double x)
+	static void appendStatistics(std::string& x, const Statistics<int64_t>& stats)
 	{
-		std::stringstream ss;
-		ss << std::fixed;
-		ss.precision(this->precision);
-		ss << x;
-		return ss.str();
+		appendNumber(x, stats.getMin());
+		appendNumber(x, stats.getMean());
+		appendNumber(x, stats.getMax());
+		appendNumber(x, stats.getVariance());
+		appendNumber(x, stats.getStandardDeviation());
+		appendNumber(x, stats.getSkewness());
+		appendNumber(x, stats.getKurtosis());
+		appendNumber(x, stats.getZScore());
 	}
 
-	std::ofstream ofs;
-	const size_t precision{5};
-	bool hasWrittenHeader{false};
+	std::string fileName;
+	std::vector<Row> rows;
+
+	/// The problem space axes of all rows, in the order they were first seen.
+	std::vector<std::string> axes;
+
+	/// The sorted user-defined measurement columns.
+	std::vector<std::string> fields;
 };
 
 ResultTable::ResultTable() : pimpl()
@@ -97,6 +253,13 @@ void ResultTable::setFileName(const std::string& x)
 	this->pimpl->setFileName(x);
 }
 
+void ResultTable::setUserDefinedFields(const std::vector<std::string>& x)
+{
+	std::set<std::string> fields(std::begin(this->pimpl->fields), std::end(this->pimpl->fields));
+	fields.insert(std::begin(x), std::end(x));
+	this->pimpl->fields.assign(std::begin(fields), std::end(fields));
+}
+
 void ResultTable::closeFile()
 {
 	this->pimpl->closeFile();
@@ -104,64 +267,105 @@ void ResultTable::closeFile()
 
 void ResultTable::add(std::shared_ptr<celero::ExperimentResult> x)
 {
-	if(this->pimpl->ofs.is_open() == true)
+	if(this->pimpl->fileName.empty() == true || x == nullptr || x->getExperiment() == nullptr)
 	{
-		if(this->pimpl->hasWrittenHeader == false)
-		{
-			// Print the header for the table.
-			this->pimpl->ofs << "Group,Experiment,Problem Space,Samples,Iterations,Failure,";
+		return;
+	}
+
+	Impl::Row row;
 
-			this->pimpl->ofs << "Baseline,us/Iteration,Iterations/sec,";
+	// Description
+	Impl::appendString(row.description, x->getExperiment()->getBenchmark()->getName());
+	Impl::appendString(row.description, x->getExperiment()->getName());
+	Impl::appendNumber(row.description, x->getProblemSpaceValue());
 
-			this->pimpl->ofs << "T Min (us),T Mean (us),T Max (us),T Variance,T Standard Deviation,T Skewness,T Kurtosis,T Z Score,";
-			this->pimpl->ofs << "R Min (us),R Mean (us),R Max (us),R Variance,R Standard Deviation,R Skewness,R Kurtosis,R Z Score,";
+	if(x->getProblemSpace() != nullptr)
+	{
+		row.parameters = x->getProblemSpace()->Parameters;
 
-			// User Defined Metrics
-			const auto udmCollector = x->getUserDefinedMeasurements();
-			if(udmCollector != nullptr)
+		for(const auto& i : row.parameters)
+		{
+			if(std::find(std::begin(this->pimpl->axes), std::end(this->pimpl->axes), i.first) == std::end(this->pimpl->axes))
 			{
-				for(const auto& entry : udmCollector->getAggregateValues())
-				{
-					this->pimpl->ofs << entry.first << ",";
-				}
+				this->pimpl->axes.push_back(i.first);
 			}
+		}
+	}
 
-			// Purposefully flushing the buffer here.
-			this->pimpl->ofs << "\n";
+	Impl::appendNumber(row.cells, x->getExperiment()->getSamples());
+	Impl::appendNumber(row.cells, x->getProblemSpaceIterations());
+	row.cells += (x->getFailure() ? "1," : "0,");
 
-			this->pimpl->hasWrittenHeader = true;
-		}
+	// Measurements
+	Impl::appendNumber(row.cells, x->getBaselineMeasurement());
+	Impl::appendNumber(row.cells, x->getUsPerCall());
+	Impl::appendNumber(row.cells, x->getCallsPerSecond());
 
-		// Description
-		this->pimpl->ofs << x->getExperiment()->getBenchmark()->getName() << "," << x->getExperiment()->getName() << "," << x->getProblemSpaceValue()
-						 << "," << x->getExperiment()->getSamples() << "," << x->getProblemSpaceIterations() << "," << x->getFailure() << ",";
+	// Throughput is left empty for fixtures which do not report what an iteration processes.
+	if(x->getBytesPerIteration() > 0)
+	{
+		Impl::appendNumber(row.cells, x->getBytesPerSecond());
+	}
+	else
+	{
+		row.cells += ",";
+	}
 
-		// Measurements
-		this->pimpl->ofs << x->getBaselineMeasurement() << "," << x->getUsPerCall() << "," << x->getCallsPerSecond() << ",";
+	if(x->getItemsPerIteration() > 0)
+	{
+		Impl::appendNumber(row.cells, x->getItemsPerSecond());
+	}
+	else
+	{
+		row.cells += ",";
+	}
 
-		// Statistics
-		this->pimpl->ofs << x->getTimeStatistics().getMin() << "," << x->getTimeStatistics().getMean() << "," << x->getTimeStatistics().getMax()
-						 << "," << x->getTimeStatistics().getVariance() << "," << x->getTimeStatistics().getStandardDeviation() << ","
-						 << x->getTimeStatistics().getSkewness() << "," << x->getTimeStatistics().getKurtosis() << ","
-						 << x->getTimeStatistics().getZScore() << ",";
+	// Statistics
+	Impl::appendStatistics(row.cells, x->getTimeStatistics());
+	Impl::appendStatistics(row.cells, x->getRAMStatistics());
 
-		// Statistics
-		this->pimpl->ofs << x->getRAMStatistics().getMin() << "," << x->getRAMStatistics().getMean() << "," << x->getRAMStatistics().getMax() << ","
-						 << x->getRAMStatistics().getVariance() << "," << x->getRAMStatistics().getStandardDeviation() << ","
-						 << x->getRAMStatistics().getSkewness() << "," << x->getRAMStatistics().getKurtosis() << ","
-						 << x->getRAMStatistics().getZScore() << ",";
+	// Warm-up
+	Impl::appendNumber(row.cells, static_cast<uint64_t>(x->getWarmupStatistics().getSize()));
+	Impl::appendNumber(row.cells, x->getWarmupFirstRunTime());
+	Impl::appendNumber(row.cells, x->getWarmupStatistics().getMean());
+	Impl::appendNumber(row.cells, x->getWarmupStatistics().getMin());
 
-		// User Defined Metrics
-		const auto udmCollector = x->getUserDefinedMeasurements();
-		if(udmCollector != nullptr)
+	// User Defined Metrics
+	const auto udmCollector = x->getUserDefinedMeasurements();
+
+	if(udmCollector != nullptr)
+	{
+		// Already sorted by name.
+		row.userDefined = udmCollector->getAggregateValues();
+
+		// Any field not announced up front still gets a column.
+		auto known = true;
+
+		for(const auto& i : row.userDefined)
 		{
-			for(const auto& entry : udmCollector->getAggregateValues())
+			known = known && std::binary_search(std::begin(this->pimpl->fields), std::end(this->pimpl->fields), i.first);
+		}
+
+		if(known == false)
+		{
+			std::vector<std::string> names;
+
+			for(const auto& i : row.userDefined)
 			{
-				this->pimpl->ofs << entry.second << ",";
+				names.push_back(i.first);
 			}
+
+			this->setUserDefinedFields(names);
 		}
+	}
+
+	this->pimpl->rows.push_back(std::move(row));
+}
 
-		// Purposefully flushing the buffer here.
-		this->pimpl->ofs << "\n";
+void ResultTable::save()
+{
+	if(this->pimpl->fileName.empty() == false)
+	{
+		this->pimpl->save();
 	}
 }
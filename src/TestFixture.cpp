@@ -24,6 +24,33 @@
 
 using namespace celero;
 
+namespace
+{
+	///
+	/// The cost of one read of the nanosecond clock, measured once.
+	///
+	/// An interval between two reads, such as a timed iteration or a pauseTiming()/resumeTiming() pair, includes roughly one read's worth
+	/// of that cost.
+	///
+	uint64_t ClockReadOverhead()
+	{
+		static const auto overhead = []() {
+			constexpr uint64_t Reads{1000};
+
+			const auto start = celero::timer::GetSystemTimeNs();
+
+			for(auto i = Reads; i > 0; --i)
+			{
+				celero::timer::GetSystemTimeNs();
+			}
+
+			return (celero::timer::GetSystemTimeNs() - start) / Reads;
+		}();
+
+		return overhead;
+	}
+} // namespace
+
 TestFixture::TestFixture()
 {
 }
@@ -79,10 +106,51 @@ uint64_t TestFixture::run(const uint64_t, const uint64_t iterations, const celer
 		// Set up the testing fixture.
 		this->setUp(experimentValue);
 		this->setExperimentIterations(iterations);
+		this->makeCachesCold();
+
+		// Only pauses and reported times from the iterations themselves count.
+		this->pausedTime = 0;
+		this->pauseCount = 0;
+		this->manualTime = 0;
+		this->isPaused = false;
+		this->isManuallyTimed = false;
 
 		// Run the test body for each iterations.
 		auto iterationCounter = iterations;
 
+		if(celero::cache::GetMode() == celero::cache::Mode::Iteration)
+		{
+			// Time each iteration on its own so that making the caches cold in between is not measured.  Iterations may well be shorter than
+			// a microsecond, so they are timed and summed in nanoseconds, without the cost of reading the clock.
+			const auto overhead = ClockReadOverhead();
+			uint64_t totalTimeNs = 0;
+
+			while(iterationCounter--)
+			{
+				const auto iterationStartTime = celero::timer::GetSystemTimeNs();
+
+				this->onExperimentStart(experimentValue);
+
+				this->UserBenchmark();
+
+				this->onExperimentEnd();
+
+				// A pause left open ends with the iteration.
+				this->resumeTiming();
+
+				const auto iterationTime = celero::timer::GetSystemTimeNs() - iterationStartTime;
+				totalTimeNs += (iterationTime > overhead) ? (iterationTime - overhead) : 0;
+
+				this->makeCachesCold();
+			}
+
+			totalTime = this->getAdjustedSampleTime(totalTimeNs / 1000);
+
+			this->setExperimentTime(totalTime);
+			this->tearDown();
+			return totalTime;
+		}
+
 		// Get the starting time.
 		const auto startTime = celero::timer::GetSystemTime();
 
@@ -99,8 +167,12 @@ uint64_t TestFixture::run(const uint64_t, const uint64_t iterations, const celer
 			this->onExperimentEnd();
 		}
 
+		// A pause left open ends with the sample.
+		this->resumeTiming();
+
 		// See how long it took.
 		totalTime += celero::timer::GetSystemTime() - startTime;
+		totalTime = this->getAdjustedSampleTime(totalTime);
 
 		this->setExperimentTime(totalTime);
 
@@ -118,6 +190,87 @@ void TestFixture::UserBenchmark()
 {
 }
 
+TestFixture::FixtureLifetime TestFixture::getFixtureLifetime() const
+{
+	return FixtureLifetime::Default;
+}
+
+void TestFixture::onReuse(const celero::TestFixture::ExperimentValue* const)
+{
+}
+
+void TestFixture::pauseTiming()
+{
+	if(this->isPaused == false)
+	{
+		this->isPaused = true;
+		this->pauseStartTime = celero::timer::GetSystemTimeNs();
+	}
+}
+
+void TestFixture::resumeTiming()
+{
+	if(this->isPaused == true)
+	{
+		this->pausedTime += celero::timer::GetSystemTimeNs() - this->pauseStartTime;
+		this->pauseCount++;
+		this->isPaused = false;
+	}
+}
+
+void TestFixture::setIterationTime(uint64_t nanoseconds)
+{
+	this->manualTime += nanoseconds;
+	this->isManuallyTimed = true;
+}
+
+uint64_t TestFixture::getAdjustedSampleTime(uint64_t measured) const
+{
+	if(this->isManuallyTimed == true)
+	{
+		return this->manualTime / 1000;
+	}
+
+	if(this->pauseCount == 0)
+	{
+		return measured;
+	}
+
+	const auto excluded = (this->pausedTime + this->pauseCount * ClockReadOverhead()) / 1000;
+	return (measured > excluded) ? (measured - excluded) : 0;
+}
+
+std::vector<celero::cache::Region> TestFixture::getColdCacheRegions() const
+{
+	return {};
+}
+
+void TestFixture::makeCachesCold() const
+{
+	if(celero::cache::GetMode() == celero::cache::Mode::None)
+	{
+		return;
+	}
+
+	if(celero::cache::GetMethod() == celero::cache::Method::Evict)
+	{
+		const auto regions = this->getColdCacheRegions();
+		auto evicted = (regions.empty() == false);
+
+		for(const auto& region : regions)
+		{
+			evicted = celero::cache::Evict(region.Data, region.Size) && evicted;
+		}
+
+		if(evicted == true)
+		{
+			return;
+		}
+	}
+
+	celero::cache::Flush();
+}
+
 uint64_t TestFixture::HardCodedMeasurement() const
 {
 	return uint64_t(0);
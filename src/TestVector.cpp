@@ -18,9 +18,12 @@
 
 #include <celero/Benchmark.h>
 #include <celero/PimplImpl.h>
+#include <celero/Registration.h>
 #include <celero/TestVector.h>
 #include <algorithm>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 using namespace celero;
@@ -39,8 +42,35 @@ public:
 	{
 	}
 
+	///
+	/// Turns the registrations declared since the last call into benchmarks, in the order they were declared.
+	///
+	/// Runs without holding the mutex, since each registration adds itself through RegisterTest() or RegisterBaseline().
+	///
+	static void registerPending()
+	{
+		const auto pending = Registration::TakePending();
+
+		if(pending == nullptr)
+		{
+			return;
+		}
+
+		std::vector<const Registration*> ordered;
+
+		for(auto i = pending; i != nullptr; i = i->getNext())
+		{
+			ordered.push_back(i);
+		}
+
+		std::for_each(ordered.rbegin(), ordered.rend(), [](const Registration* x) { x->apply(); });
+	}
+
 	mutable std::mutex testVectorMutex;
 	std::vector<std::shared_ptr<Benchmark>> testVector;
+
+	/// The index of each group in testVector.
+	std::unordered_map<std::string, size_t> groupIndex;
 };
 
 TestVector::TestVector() : pimpl()
@@ -59,47 +89,58 @@ TestVector& TestVector::Instance()
 
 void TestVector::push_back(std::shared_ptr<Benchmark> x)
 {
+	Impl::registerPending();
+
 	std::lock_guard<std::mutex> mutexLock(this->pimpl->testVectorMutex);
+	this->pimpl->groupIndex.emplace(x->getName(), this->pimpl->testVector.size());
 	this->pimpl->testVector.push_back(x);
 }
 
 void TestVector::clear()
 {
+	// Pending registrations are discarded along with the registered ones.
+	Registration::TakePending();
+
+	std::lock_guard<std::mutex> mutexLock(this->pimpl->testVectorMutex);
 	this->pimpl->testVector.clear();
+	this->pimpl->groupIndex.clear();
 }
 
 size_t TestVector::size() const
 {
+	Impl::registerPending();
+
 	std::lock_guard<std::mutex> mutexLock(this->pimpl->testVectorMutex);
 	return this->pimpl->testVector.size();
 }
 
 bool TestVector::containsGroup(const std::string& x) const
 {
-	std::lock_guard<std::mutex> mutexLock(this->pimpl->testVectorMutex);
+	Impl::registerPending();
 
-	const auto found = std::find_if(std::begin(this->pimpl->testVector), std::end(this->pimpl->testVector),
-									[x](std::shared_ptr<Benchmark> const& bmark) -> bool { return (bmark->getName() == x); });
-
-	return found != std::end(this->pimpl->testVector);
+	std::lock_guard<std::mutex> mutexLock(this->pimpl->testVectorMutex);
+	return this->pimpl->groupIndex.find(x) != std::end(this->pimpl->groupIndex);
 }
 
 std::shared_ptr<Benchmark> TestVector::operator[](size_t x)
 {
+	Impl::registerPending();
+
 	std::lock_guard<std::mutex> mutexLock(this->pimpl->testVectorMutex);
 	return this->pimpl->testVector[x];
 }
 
 std::shared_ptr<Benchmark> TestVector::operator[](const std::string& x)
 {
+	Impl::registerPending();
+
 	std::lock_guard<std::mutex> mutexLock(this->pimpl->testVectorMutex);
 
-	const auto found = std::find_if(std::begin(this->pimpl->testVector), std::end(this->pimpl->testVector),
-									[x](std::shared_ptr<Benchmark> const& bmark) -> bool { return (bmark->getName() == x); });
+	const auto found = this->pimpl->groupIndex.find(x);
 
-	if(found != std::end(this->pimpl->testVector))
+	if(found != std::end(this->pimpl->groupIndex))
 	{
-		return *found;
+		return this->pimpl->testVector[found->second];
 	}
 
 	return nullptr;
@@ -20,6 +20,7 @@
 
 #include <assert.h>
 #include <celero/PimplImpl.h>
+#include <celero/UserDefinedMeasurement.h>
 #include <algorithm>
 #include <future>
 #include <iostream>
@@ -57,11 +58,15 @@ void ThreadTestFixture::startThreads(uint64_t threads, uint64_t iterations)
 				// std::async(std::launch::deferred,
 				std::async(std::launch::async, [this, i, iterationsPerThread]() {
 					this->pimpl->currentThreadId = i + 1;
+					UserDefinedMeasurement::SetThreadShard(static_cast<size_t>(i + 1));
 					for(auto threadIterationCounter = size_t(0); threadIterationCounter < iterationsPerThread;)
 					{
 						this->pimpl->currentCallId = ++threadIterationCounter;
 						this->UserBenchmark();
 					}
+
+					// Threads may be pooled and reused for other work.
+					UserDefinedMeasurement::SetThreadShard(0);
 				}));
 		}
 		catch(std::system_error& e)
@@ -98,6 +103,17 @@ uint64_t ThreadTestFixture::run(uint64_t threads, uint64_t calls, const celero::
 		// Set up the testing fixture.
 		this->setUp(experimentValue);
 
+		// Iterations run concurrently, so caches can only be made cold once per sample.
+		this->makeCachesCold();
+
+		// Give each worker its own measurement shards.  This is done outside of the timed region, as is folding them back together.
+		const auto udms = this->getUserDefinedMeasurements();
+
+		for(const auto& udm : udms)
+		{
+			udm->beginThreads(static_cast<size_t>(threads));
+		}
+
 		// Get the starting time.
 		const auto startTime = celero::timer::GetSystemTime();
 
@@ -113,6 +129,11 @@ uint64_t ThreadTestFixture::run(uint64_t threads, uint64_t calls, const celero::
 
 		const auto endTime = celero::timer::GetSystemTime();
 
+		for(const auto& udm : udms)
+		{
+			udm->endThreads();
+		}
+
 		// Tear down the testing fixture.
 		this->tearDown();
 
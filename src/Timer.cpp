@@ -48,6 +48,27 @@ uint64_t celero::timer::GetSystemTime()
 #endif
 }
 
+uint64_t celero::timer::GetSystemTimeNs()
+{
+#ifdef _WIN32
+	LARGE_INTEGER timeStorage;
+	QueryPerformanceCounter(&timeStorage);
+
+	if(QPCFrequency.QuadPart == 0)
+	{
+		QueryPerformanceFrequency(&QPCFrequency);
+	}
+
+	// Split the conversion so that the multiplication cannot overflow.
+	const auto ticks = static_cast<uint64_t>(timeStorage.QuadPart);
+	const auto frequency = static_cast<uint64_t>(QPCFrequency.QuadPart);
+	return (ticks / frequency) * 1000000000 + ((ticks % frequency) * 1000000000) / frequency;
+#else
+	const auto timePoint = std::chrono::steady_clock::now();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint.time_since_epoch()).count();
+#endif
+}
+
 double celero::timer::CachePerformanceFrequency(bool quiet)
 {
 #ifdef _WIN32
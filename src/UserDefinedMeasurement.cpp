@@ -0,0 +1,39 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/UserDefinedMeasurement.h>
+
+using namespace celero;
+
+#if defined(_WIN32) && !defined(CELERO_STATIC)
+namespace
+{
+	/// The worker index of the current thread.  Kept in this translation unit so that every module sees the same value.
+	thread_local size_t ThreadShard{0};
+} // namespace
+
+void UserDefinedMeasurement::SetThreadShard(size_t x)
+{
+	ThreadShard = x;
+}
+
+size_t UserDefinedMeasurement::GetThreadShard()
+{
+	return ThreadShard;
+}
+#endif
@@ -19,37 +19,57 @@
 #include <celero/TestFixture.h>
 #include <celero/UserDefinedMeasurementCollector.h>
 
+#include <algorithm>
+
 using namespace celero;
 
 UserDefinedMeasurementCollector::UserDefinedMeasurementCollector(std::shared_ptr<TestFixture> fixture)
+	: UserDefinedMeasurementCollector(fixture->getUserDefinedMeasurementNames())
 {
-	const auto udm = fixture->getUserDefinedMeasurementNames();
+}
 
-	if(udm.empty() == false)
-	{
-		for(const auto& name : fixture->getUserDefinedMeasurementNames())
-		{
-			this->collected[name] = nullptr;
-		}
-	}
+UserDefinedMeasurementCollector::UserDefinedMeasurementCollector(const std::vector<std::string>& x) : names(x), slots(x.size())
+{
 }
 
 void UserDefinedMeasurementCollector::collect(std::shared_ptr<TestFixture> fixture)
 {
-	const auto udms = fixture->getUserDefinedMeasurements();
+	this->collect(fixture->getUserDefinedMeasurements());
+}
 
-	if(udms.empty() == false)
+void UserDefinedMeasurementCollector::collect(const std::vector<std::shared_ptr<UserDefinedMeasurement>>& udms)
+{
+	// Resolve the slots by name once.  A fixture which returns a different number of measurements is resolved again.
+	if(this->slotOfPosition.size() != udms.size())
 	{
+		this->slotOfPosition.clear();
+
 		for(const auto& udm : udms)
 		{
-			if(this->collected[udm->getName()] == nullptr)
-			{
-				this->collected[udm->getName()] = udm;
-			}
-			else
-			{
-				this->collected[udm->getName()]->merge(&*udm);
-			}
+			this->slotOfPosition.push_back(this->getSlot(udm->getName()));
+		}
+	}
+
+	for(size_t i = 0; i < udms.size(); ++i)
+	{
+		// Comparing with the slot's name is much cheaper than looking it up, and catches a fixture which returned its measurements in a
+		// different order.  Merging into another measurement's slot would mix different measurements.
+		const auto name = udms[i]->getName();
+
+		if(this->names[this->slotOfPosition[i]] != name)
+		{
+			this->slotOfPosition[i] = this->getSlot(name);
+		}
+
+		auto& slot = this->slots[this->slotOfPosition[i]];
+
+		if(slot == nullptr)
+		{
+			slot = udms[i];
+		}
+		else
+		{
+			slot->merge(udms[i].get());
 		}
 	}
 }
@@ -73,21 +93,51 @@ std::vector<std::string> UserDefinedMeasurementCollector::getFields(std::shared_
 	return fields;
 }
 
-std::vector<std::pair<std::string, double>> UserDefinedMeasurementCollector::getAggregateValues() const
+const std::vector<std::pair<std::string, double>>& UserDefinedMeasurementCollector::getAggregateValues() const
 {
-	std::vector<std::pair<std::string, double>> aggregates;
+	if(this->isFrozen == true)
+	{
+		return this->aggregates;
+	}
+
+	this->aggregates.clear();
 
-	for(const auto& collectedEntry : this->collected)
+	for(size_t i = 0; i < this->slots.size(); ++i)
 	{
-		const auto name = collectedEntry.first;
-		const auto collectedUDMs = collectedEntry.second;
+		// Nothing was collected for this name, for example because the run failed.
+		if(this->slots[i] == nullptr)
+		{
+			continue;
+		}
 
-		for(const auto& aggDesc : collectedUDMs->getAggregationInfo())
+		for(const auto& aggDesc : this->slots[i]->getAggregationInfo())
 		{
-			const auto fieldName = name + std::string(" ") + aggDesc.first;
-			aggregates.emplace_back(fieldName, (aggDesc.second)());
+			this->aggregates.emplace_back(this->names[i] + std::string(" ") + aggDesc.first, (aggDesc.second)());
 		}
 	}
 
-	return aggregates;
+	std::sort(std::begin(this->aggregates), std::end(this->aggregates));
+	return this->aggregates;
+}
+
+void UserDefinedMeasurementCollector::freeze()
+{
+	this->isFrozen = false;
+	this->getAggregateValues();
+	this->isFrozen = true;
+}
+
+size_t UserDefinedMeasurementCollector::getSlot(const std::string& name)
+{
+	const auto found = std::find(std::begin(this->names), std::end(this->names), name);
+
+	if(found != std::end(this->names))
+	{
+		return static_cast<size_t>(std::distance(std::begin(this->names), found));
+	}
+
+	// Not announced up front, so it gets a new slot.
+	this->names.push_back(name);
+	this->slots.emplace_back();
+	return this->names.size() - 1;
 }
@@ -29,26 +29,28 @@
 #undef max
 #endif
 
+#include <cstdio>
 #include <limits>
 #include <random>
 
+void celero::impl::UseCharPointer(const volatile char*)
+{
+}
+
+bool celero::impl::AtomicReplaceFile(const std::string& source, const std::string& target)
+{
+#ifdef _WIN32
+	return MoveFileExA(source.c_str(), target.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+	return std::rename(source.c_str(), target.c_str()) == 0;
+#endif
+}
+
 template <>
 void celero::DoNotOptimizeAway(std::function<void(void)>&& x)
 {
 	x();
-
-	// We must always do this test, but it will never pass.
-	static auto ttid = std::this_thread::get_id();
-	if(ttid == std::thread::id())
-	{
-		// This forces the value to never be optimized away
-		// by taking a reference then using it.
-		const auto* p = &x;
-		putchar(*reinterpret_cast<const char*>(p));
-
-		// If we do get here, kick out because something has gone wrong.
-		std::abort();
-	}
+	celero::ClobberMemory();
 }
 
 int celero::Random()
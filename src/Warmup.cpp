@@ -0,0 +1,203 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Pimpl.h>
+#include <celero/PimplImpl.h>
+#include <celero/Warmup.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+using namespace celero;
+
+namespace
+{
+	///
+	/// Parse an unsigned decimal number with std::strtoull, which would otherwise accept a sign and wrap "-1" around to 2^64-1.
+	///
+	/// On anything but a leading digit, nothing is parsed and end is set to text.
+	///
+	uint64_t ParseUnsigned(const char* text, char** end)
+	{
+		if(std::isdigit(static_cast<unsigned char>(*text)) == 0)
+		{
+			*end = const_cast<char*>(text);
+			return 0;
+		}
+
+		return std::strtoull(text, end, 10);
+	}
+} // namespace
+
+///
+/// \class Impl
+///
+class celero::Warmup::Impl
+{
+public:
+	Warmup::Mode mode{Warmup::Mode::Count};
+	uint64_t count{1};
+	uint64_t duration{0};
+	double percent{0.0};
+	size_t window{3};
+	uint64_t maxSamples{100};
+};
+
+Warmup::Warmup() : pimpl()
+{
+}
+
+Warmup::~Warmup()
+{
+}
+
+Warmup& Warmup::Instance()
+{
+	static Warmup singleton;
+	return singleton;
+}
+
+void Warmup::setCount(uint64_t x)
+{
+	this->pimpl->mode = Mode::Count;
+	this->pimpl->count = x;
+}
+
+void Warmup::setDuration(uint64_t x)
+{
+	this->pimpl->mode = Mode::Duration;
+	this->pimpl->duration = x;
+}
+
+void Warmup::setStable(double percent, size_t window, uint64_t maxSamples)
+{
+	this->pimpl->mode = Mode::Stable;
+	this->pimpl->percent = std::max(percent, 0.0);
+	this->pimpl->window = std::max(window, size_t(2));
+	this->pimpl->maxSamples = std::max(maxSamples, uint64_t(1));
+}
+
+bool Warmup::setPolicy(const std::string& x)
+{
+	const std::string stablePrefix{"stable:"};
+	char* end = nullptr;
+
+	if(x.compare(0, stablePrefix.size(), stablePrefix) == 0)
+	{
+		const auto percent = std::strtod(x.c_str() + stablePrefix.size(), &end);
+
+		if(end == x.c_str() + stablePrefix.size() || percent < 0.0)
+		{
+			return false;
+		}
+
+		auto maxSamples = uint64_t(100);
+
+		if(*end == ':')
+		{
+			const auto maxText = end + 1;
+			maxSamples = ParseUnsigned(maxText, &end);
+
+			if(end == maxText || maxSamples == 0)
+			{
+				return false;
+			}
+		}
+
+		if(*end != '\0')
+		{
+			return false;
+		}
+
+		this->setStable(percent, 3, maxSamples);
+		return true;
+	}
+
+	const auto value = ParseUnsigned(x.c_str(), &end);
+
+	if(end == x.c_str())
+	{
+		return false;
+	}
+
+	const std::string unit{end};
+
+	if(unit.empty() == true)
+	{
+		this->setCount(value);
+	}
+	else if(unit == "us")
+	{
+		this->setDuration(value);
+	}
+	else if(unit == "ms")
+	{
+		this->setDuration(value * 1000);
+	}
+	else if(unit == "s")
+	{
+		this->setDuration(value * 1000000);
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+Warmup::Mode Warmup::getMode() const
+{
+	return this->pimpl->mode;
+}
+
+bool Warmup::isComplete(const std::vector<uint64_t>& samples, uint64_t elapsed) const
+{
+	switch(this->pimpl->mode)
+	{
+		case Mode::Count:
+			return samples.size() >= this->pimpl->count;
+
+		case Mode::Duration:
+			return (samples.empty() == false) && (elapsed >= this->pimpl->duration);
+
+		case Mode::Stable:
+		{
+			if(samples.size() >= this->pimpl->maxSamples)
+			{
+				return true;
+			}
+
+			if(samples.size() < this->pimpl->window)
+			{
+				return false;
+			}
+
+			const auto first = std::end(samples) - static_cast<std::ptrdiff_t>(this->pimpl->window);
+			const auto range = std::minmax_element(first, std::end(samples));
+			const auto low = static_cast<double>(*range.first);
+			const auto high = static_cast<double>(*range.second);
+
+			// A run too short to time is as stable as it will get.
+			return (high == 0.0) || ((high - low) <= low * this->pimpl->percent / 100.0);
+		}
+	}
+
+	return true;
+}
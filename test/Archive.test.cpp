@@ -17,8 +17,15 @@
 ///
 
 #include <celero/Archive.h>
+#include <celero/Benchmark.h>
+#include <celero/Experiment.h>
+#include <celero/ExperimentResult.h>
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <string>
+#include <vector>
+
 TEST(Archive, Instance)
 {
 	EXPECT_NO_THROW(celero::Archive::Instance());
@@ -97,3 +104,246 @@ TEST(Archive, saveToInvalidPath)
 	archive.setFileName(longFileName);
 	EXPECT_NO_THROW(archive.save());
 }
+
+TEST(Archive, convertRoundTrip)
+{
+	const std::string csvFile{"ArchiveConvert.csv"};
+	const std::string binaryFile{"ArchiveConvert.bin"};
+	const std::string csvRoundTripFile{"ArchiveConvertRoundTrip.csv"};
+
+	{
+		std::ofstream os(csvFile);
+		os << "header\n";
+		os << "Group,Run,0,64,1,1000,3,0.5,0.25,1001,30,10.5,1.5,1.2,0,0,9,12,0.75,1002,30,11.5,1.5,1.2,0,0,10,13,0.5,1003,30,11,1.5,1.2,0,0,9,13\n";
+	}
+
+	EXPECT_EQ(celero::Archive::Format::CSV, celero::Archive::DetectFormat(csvFile));
+	EXPECT_TRUE(celero::Archive::Convert(csvFile, binaryFile, celero::Archive::Format::Binary));
+	EXPECT_EQ(celero::Archive::Format::Binary, celero::Archive::DetectFormat(binaryFile));
+	EXPECT_TRUE(celero::Archive::Convert(binaryFile, csvRoundTripFile, celero::Archive::Format::CSV));
+
+	std::ifstream is(csvRoundTripFile);
+	std::string header;
+	std::string row;
+	std::getline(is, header);
+	std::getline(is, row);
+
+	EXPECT_EQ(std::string{"Group,Run,0,64,1,1000,3,0.5,0.25,1001,30,10.5,1.5,1.2,0,0,9,12,0.75,1002,30,11.5,1.5,1.2,0,0,10,13,0.5,1003,30,11,1.5,1.2,0,0,9,13"},
+			  row);
+}
+
+TEST(Archive, convertMissingFile)
+{
+	EXPECT_FALSE(celero::Archive::Convert(std::string{"DoesNotExist.csv"}, std::string{"DoesNotExist.bin"}, celero::Archive::Format::Binary));
+	EXPECT_EQ(celero::Archive::Format::CSV, celero::Archive::DetectFormat(std::string{"DoesNotExist.bin"}));
+}
+
+TEST(Archive, convertParameters)
+{
+	const std::string csvFile{"ArchiveParameters.csv"};
+	const std::string binaryFile{"ArchiveParameters.bin"};
+	const std::string csvRoundTripFile{"ArchiveParametersRoundTrip.csv"};
+
+	const std::string withParameters{
+		"Group,Run,0,64,1,1000,3,0.5,0.25,1001,30,10.5,1.5,1.2,0,0,9,12,0.75,1002,30,11.5,1.5,1.2,0,0,10,13,0.5,1003,30,11,1.5,1.2,0,0,9,13,size=64;threads=4"};
+	const std::string withoutParameters{
+		"Group,Run,0,64,1,1000,3,0.5,0.25,1001,30,10.5,1.5,1.2,0,0,9,12,0.75,1002,30,11.5,1.5,1.2,0,0,10,13,0.5,1003,30,11,1.5,1.2,0,0,9,13"};
+
+	{
+		std::ofstream os(csvFile);
+		os << "header\n";
+		os << withParameters << "\n";
+		os << withoutParameters << "\n";
+	}
+
+	EXPECT_TRUE(celero::Archive::Convert(csvFile, binaryFile, celero::Archive::Format::Binary));
+	EXPECT_TRUE(celero::Archive::Convert(binaryFile, csvRoundTripFile, celero::Archive::Format::CSV));
+
+	std::ifstream is(csvRoundTripFile);
+	std::string header;
+	std::string row;
+	std::getline(is, header);
+
+	EXPECT_NE(std::string::npos, header.find(",Parameters"));
+
+	std::getline(is, row);
+	EXPECT_EQ(withParameters, row);
+
+	std::getline(is, row);
+	EXPECT_EQ(withoutParameters, row);
+}
+
+TEST(Archive, convertThroughput)
+{
+	const std::string csvFile{"ArchiveThroughput.csv"};
+	const std::string binaryFile{"ArchiveThroughput.bin"};
+	const std::string csvRoundTripFile{"ArchiveThroughputRoundTrip.csv"};
+
+	const std::string withThroughput{
+		"Group,Run,0,64,1,1000,3,0.5,0.25,1001,30,10.5,1.5,1.2,0,0,9,12,0.75,1002,30,11.5,1.5,1.2,0,0,10,13,0.5,1003,30,11,1.5,1.2,0,0,9,13,,4096,64"};
+	const std::string withBoth{
+		"Group,Run,0,64,1,1000,3,0.5,0.25,1001,30,10.5,1.5,1.2,0,0,9,12,0.75,1002,30,11.5,1.5,1.2,0,0,10,13,0.5,1003,30,11,1.5,1.2,0,0,9,13,size=64,512,0"};
+
+	{
+		std::ofstream os(csvFile);
+		os << "header\n";
+		os << withThroughput << "\n";
+		os << withBoth << "\n";
+	}
+
+	EXPECT_TRUE(celero::Archive::Convert(csvFile, binaryFile, celero::Archive::Format::Binary));
+	EXPECT_TRUE(celero::Archive::Convert(binaryFile, csvRoundTripFile, celero::Archive::Format::CSV));
+
+	std::ifstream is(csvRoundTripFile);
+	std::string header;
+	std::string row;
+	std::getline(is, header);
+
+	EXPECT_NE(std::string::npos, header.find(",Parameters,BytesPerIteration,ItemsPerIteration"));
+
+	std::getline(is, row);
+	EXPECT_EQ(withThroughput, row);
+
+	std::getline(is, row);
+	EXPECT_EQ(withBoth, row);
+}
+
+namespace
+{
+	///
+	/// Overwrite eight bytes of a file in place.
+	///
+	void PatchUint64(const std::string& fileName, std::streamoff offset, uint64_t value)
+	{
+		std::fstream fs(fileName, std::fstream::in | std::fstream::out | std::fstream::binary);
+		fs.seekp(offset);
+		fs.write(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+
+	uint32_t ReadUint32(const std::string& fileName, std::streamoff offset)
+	{
+		uint32_t value{0};
+		std::ifstream is(fileName, std::fstream::binary);
+		is.seekg(offset);
+		is.read(reinterpret_cast<char*>(&value), sizeof(value));
+		return value;
+	}
+} // namespace
+
+TEST(Archive, corruptBinaryHeader)
+{
+	const std::string csvFile{"ArchiveCorrupt.csv"};
+	const std::string binaryFile{"ArchiveCorrupt.bin"};
+
+	{
+		std::ofstream os(csvFile);
+		os << "header\n";
+		os << "Group,Run,0,64,1,1000,3,0.5,0.25,1001,30,10.5,1.5,1.2,0,0,9,12,0.75,1002,30,11.5,1.5,1.2,0,0,10,13,0.5,1003,30,11,1.5,1.2,0,0,9,13\n";
+	}
+
+	// The header is Magic[8], Version, ByteOrder, HeaderSize, RecordSize (uint32_t each), RecordCount, StringTableSize (uint64_t each).
+	const std::streamoff recordSizeOffset{20};
+	const std::streamoff recordCountOffset{24};
+	const std::streamoff stringTableSizeOffset{32};
+
+	// A record count whose size in bytes wraps around to zero.
+	ASSERT_TRUE(celero::Archive::Convert(csvFile, binaryFile, celero::Archive::Format::Binary));
+	PatchUint64(binaryFile, recordCountOffset, uint64_t{1} << 63);
+	EXPECT_EQ(celero::Archive::Format::CSV, celero::Archive::DetectFormat(binaryFile));
+
+	// A string table size which makes the total size wrap around to zero.
+	ASSERT_TRUE(celero::Archive::Convert(csvFile, binaryFile, celero::Archive::Format::Binary));
+	const uint64_t recordSize = ReadUint32(binaryFile, recordSizeOffset);
+	PatchUint64(binaryFile, stringTableSizeOffset, uint64_t{0} - recordSize - 40);
+	EXPECT_EQ(celero::Archive::Format::CSV, celero::Archive::DetectFormat(binaryFile));
+}
+
+TEST(Archive, corruptBinaryStringOffset)
+{
+	const std::string csvFile{"ArchiveCorruptString.csv"};
+	const std::string binaryFile{"ArchiveCorruptString.bin"};
+	const std::string csvRoundTripFile{"ArchiveCorruptStringRoundTrip.csv"};
+
+	{
+		std::ofstream os(csvFile);
+		os << "header\n";
+		os << "Group,Run,0,64,1,1000,3,0.5,0.25,1001,30,10.5,1.5,1.2,0,0,9,12,0.75,1002,30,11.5,1.5,1.2,0,0,10,13,0.5,1003,30,11,1.5,1.2,0,0,9,13\n";
+	}
+
+	ASSERT_TRUE(celero::Archive::Convert(csvFile, binaryFile, celero::Archive::Format::Binary));
+
+	// The group name offset of the first record, directly after the 40 byte header, such that offset + length wraps around.
+	PatchUint64(binaryFile, 40, uint64_t{0} - 1);
+	ASSERT_EQ(celero::Archive::Format::Binary, celero::Archive::DetectFormat(binaryFile));
+	ASSERT_TRUE(celero::Archive::Convert(binaryFile, csvRoundTripFile, celero::Archive::Format::CSV));
+
+	std::ifstream is(csvRoundTripFile);
+	std::string header;
+	std::string row;
+	std::getline(is, header);
+	std::getline(is, row);
+
+	EXPECT_EQ(0u, row.find(",Run,"));
+}
+
+TEST(Archive, updateBinaryInPlace)
+{
+	const std::string csvFile{"ArchiveInPlace.csv"};
+	const std::string binaryFile{"ArchiveInPlace.bin"};
+	const std::string csvRoundTripFile{"ArchiveInPlaceRoundTrip.csv"};
+
+	const std::string untouched{
+		"Group,Other,0,32,1,1000,3,0.5,0.25,1001,30,10.5,1.5,1.2,0,0,9,12,0.75,1002,30,11.5,1.5,1.2,0,0,10,13,0.5,1003,30,11,1.5,1.2,0,0,9,13"};
+
+	{
+		std::ofstream os(csvFile);
+		os << "header\n";
+		os << "Group,Run,0,64,1,1000,3,0.5,0.25,1001,30,10.5,1.5,1.2,0,0,9,12,0.75,1002,30,11.5,1.5,1.2,0,0,10,13,0.5,1003,30,11,1.5,1.2,0,0,9,13\n";
+		os << untouched << "\n";
+	}
+
+	ASSERT_TRUE(celero::Archive::Convert(csvFile, binaryFile, celero::Archive::Format::Binary));
+
+	auto benchmark = std::make_shared<celero::Benchmark>("Group");
+	auto experiment = std::make_shared<celero::Experiment>(benchmark, "Run", 1, 10, 1, 0.0);
+	auto newExperiment = std::make_shared<celero::Experiment>(benchmark, "New", 1, 10, 1, 0.0);
+
+	auto existing = std::make_shared<celero::ExperimentResult>(experiment.get());
+	existing->setProblemSpaceValue(std::make_shared<celero::TestFixture::ExperimentValue>(64, 10));
+	existing->addRunTimeSample(100);
+
+	auto added = std::make_shared<celero::ExperimentResult>(newExperiment.get());
+	added->setProblemSpaceValue(std::make_shared<celero::TestFixture::ExperimentValue>(16, 10));
+	added->addRunTimeSample(100);
+
+	auto& archive = celero::Archive::Instance();
+	archive.setFileName(binaryFile);
+	EXPECT_EQ(celero::Archive::Format::Binary, archive.getFormat());
+
+	// Adding only updates the results in memory; the file is written by save, and the saved archive is mapped again for the next add.
+	archive.add(existing);
+	archive.add(added);
+	archive.save();
+	archive.add(existing);
+	archive.save();
+	archive.setFileName(std::string{"ArchiveInPlaceDone.csv"});
+
+	ASSERT_TRUE(celero::Archive::Convert(binaryFile, csvRoundTripFile, celero::Archive::Format::CSV));
+
+	std::ifstream is(csvRoundTripFile);
+	std::string row;
+	std::vector<std::string> rows;
+	std::getline(is, row);
+
+	while(std::getline(is, row))
+	{
+		rows.push_back(row);
+	}
+
+	ASSERT_EQ(size_t{3}, rows.size());
+
+	// The updated record counts both new samples, the untouched record is unchanged, and the new record follows them.
+	EXPECT_EQ(0u, rows[0].find("Group,Run,0,64,1,1000,5,"));
+	EXPECT_EQ(untouched, rows[1]);
+	EXPECT_EQ(0u, rows[2].find("Group,New,0,16,1,"));
+}
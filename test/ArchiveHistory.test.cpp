@@ -0,0 +1,224 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015, 2016, 2017 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/ArchiveHistory.h>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+	celero::ArchiveHistoryPoint MakePoint(double usPerCall, const std::string& label)
+	{
+		celero::ArchiveHistoryPoint p;
+		p.Timestamp = 1000;
+		p.Label = label;
+		p.Samples = 30;
+		p.UsPerCall = usPerCall;
+		p.Mean = usPerCall * 10;
+		p.Min = 1;
+		p.Max = 100;
+		return p;
+	}
+} // namespace
+
+TEST(ArchiveHistory, addAndGet)
+{
+	celero::ArchiveHistory x;
+
+	celero::ArchiveHistoryKey a{"Group", "Baseline", 64};
+	celero::ArchiveHistoryKey b{"Group", "Experiment", 64};
+
+	x.add(a, MakePoint(1.0, "first"));
+	x.add(b, MakePoint(2.0, "first"));
+	x.add(a, MakePoint(3.0, "second"));
+
+	EXPECT_EQ(size_t(3), x.size());
+	ASSERT_EQ(size_t(2), x.getKeys().size());
+	EXPECT_EQ(a, x.getKeys()[0]);
+
+	const auto points = x.get(a);
+	ASSERT_EQ(size_t(2), points.size());
+	EXPECT_DOUBLE_EQ(1.0, points[0].UsPerCall);
+	EXPECT_DOUBLE_EQ(3.0, points[1].UsPerCall);
+	EXPECT_EQ(std::string("second"), points[1].Label);
+
+	EXPECT_TRUE(x.get(celero::ArchiveHistoryKey{"Group", "Missing", 0}).empty());
+}
+
+TEST(ArchiveHistory, saveLoadRoundTrip)
+{
+	const std::string fileName{"ArchiveHistory.saveLoadRoundTrip.history"};
+
+	celero::ArchiveHistoryKey key{"Group", "Experiment", 1024};
+
+	{
+		celero::ArchiveHistory x;
+		x.add(key, MakePoint(1.5, "abc123"));
+		x.add(key, MakePoint(2.5, ""));
+		EXPECT_TRUE(x.save(fileName));
+	}
+
+	// The history is written to a temporary file which then replaces the target.
+	EXPECT_FALSE(std::ifstream(fileName + ".tmp").is_open());
+
+	celero::ArchiveHistory y;
+	ASSERT_TRUE(y.load(fileName));
+
+	const auto points = y.get(key);
+	ASSERT_EQ(size_t(2), points.size());
+	EXPECT_DOUBLE_EQ(1.5, points[0].UsPerCall);
+	EXPECT_EQ(std::string("abc123"), points[0].Label);
+	EXPECT_EQ(uint64_t(30), points[0].Samples);
+	EXPECT_DOUBLE_EQ(2.5, points[1].UsPerCall);
+	EXPECT_TRUE(points[1].Label.empty());
+
+	// Points added after a load follow the loaded ones.
+	y.add(key, MakePoint(3.5, ""));
+	ASSERT_EQ(size_t(3), y.get(key).size());
+	EXPECT_DOUBLE_EQ(3.5, y.get(key)[2].UsPerCall);
+
+	std::remove(fileName.c_str());
+	EXPECT_FALSE(y.load(fileName));
+	EXPECT_EQ(size_t(0), y.size());
+}
+
+TEST(ArchiveHistory, parameters)
+{
+	const std::string fileName{"ArchiveHistory.parameters.history"};
+
+	celero::ArchiveHistoryKey a{"Group", "Experiment", 64, "size=64;threads=1"};
+	celero::ArchiveHistoryKey b{"Group", "Experiment", 64, "size=64;threads=4"};
+
+	{
+		celero::ArchiveHistory x;
+		x.add(a, MakePoint(1.0, ""));
+		x.add(b, MakePoint(2.0, ""));
+		EXPECT_EQ(size_t(2), x.getKeys().size());
+		EXPECT_TRUE(x.save(fileName));
+	}
+
+	celero::ArchiveHistory y;
+	ASSERT_TRUE(y.load(fileName));
+	ASSERT_EQ(size_t(2), y.getKeys().size());
+	EXPECT_EQ(a, y.getKeys()[0]);
+	EXPECT_EQ(b, y.getKeys()[1]);
+	ASSERT_EQ(size_t(1), y.get(b).size());
+	EXPECT_DOUBLE_EQ(2.0, y.get(b)[0].UsPerCall);
+
+	std::remove(fileName.c_str());
+}
+
+TEST(ArchiveHistory, TrendSlope)
+{
+	std::vector<celero::ArchiveHistoryPoint> points;
+	EXPECT_DOUBLE_EQ(0.0, celero::ArchiveHistory::TrendSlope(points));
+
+	points.push_back(MakePoint(1.0, ""));
+	points.push_back(MakePoint(2.0, ""));
+	points.push_back(MakePoint(3.0, ""));
+
+	// Slope of 1.0 per run against a mean of 2.0.
+	EXPECT_DOUBLE_EQ(50.0, celero::ArchiveHistory::TrendSlope(points));
+
+	// Sparklines are one three-byte UTF-8 character per point, lowest to highest bar.
+	const auto line = celero::ArchiveHistory::Sparkline(points);
+	EXPECT_EQ(size_t(9), line.size());
+	EXPECT_EQ(std::string("\xE2\x96\x81"), line.substr(0, 3));
+	EXPECT_EQ(std::string("\xE2\x96\x88"), line.substr(6, 3));
+}
+
+TEST(ArchiveHistory, corruptCounts)
+{
+	const std::string fileName{"ArchiveHistory.corruptCounts.history"};
+
+	celero::ArchiveHistoryKey key{"Group", "Experiment", 64};
+
+	// The header is Magic[8], Version, ByteOrder (uint32_t each), RowCount, KeyCount, LabelCount, StringTableSize (uint64_t each).
+	for(const std::streamoff offset : {16, 24, 32, 40})
+	{
+		{
+			celero::ArchiveHistory x;
+			x.add(key, MakePoint(1.0, "label"));
+			ASSERT_TRUE(x.save(fileName));
+		}
+
+		{
+			// Far more than the file holds, and too much to allocate.
+			const uint64_t count = uint64_t{1} << 40;
+			std::fstream fs(fileName, std::fstream::in | std::fstream::out | std::fstream::binary);
+			fs.seekp(offset);
+			fs.write(reinterpret_cast<const char*>(&count), sizeof(count));
+		}
+
+		celero::ArchiveHistory y;
+		EXPECT_FALSE(y.load(fileName));
+		EXPECT_EQ(size_t(0), y.size());
+	}
+
+	std::remove(fileName.c_str());
+}
+
+TEST(ArchiveHistory, truncated)
+{
+	const std::string fileName{"ArchiveHistory.truncated.history"};
+
+	{
+		celero::ArchiveHistory x;
+		x.add(celero::ArchiveHistoryKey{"Group", "Experiment", 64}, MakePoint(1.0, "label"));
+		ASSERT_TRUE(x.save(fileName));
+	}
+
+	std::string contents;
+
+	{
+		std::ifstream is(fileName, std::fstream::binary);
+		contents.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+	}
+
+	{
+		std::ofstream os(fileName, std::fstream::binary | std::fstream::trunc);
+		os.write(contents.data(), static_cast<std::streamsize>(contents.size() / 2));
+	}
+
+	celero::ArchiveHistory y;
+	EXPECT_FALSE(y.load(fileName));
+	EXPECT_EQ(size_t(0), y.size());
+
+	std::remove(fileName.c_str());
+}
+
+TEST(ArchiveHistory, printTrendsKeepsStreamFormat)
+{
+	celero::ArchiveHistory x;
+	x.add(celero::ArchiveHistoryKey{"Group", "Experiment", 64}, MakePoint(1.0, "first"));
+	x.add(celero::ArchiveHistoryKey{"Group", "Experiment", 64}, MakePoint(2.0, "second"));
+
+	std::ostringstream os;
+	os.precision(3);
+	const auto flags = os.flags();
+
+	x.printTrends(os);
+
+	EXPECT_NE(std::string::npos, os.str().find("Group.Experiment/64 "));
+	EXPECT_NE(std::string::npos, os.str().find("%/run over 2 runs, latest 2.00000 us/Iteration (second)"));
+	EXPECT_EQ(flags, os.flags());
+	EXPECT_EQ(std::streamsize(3), os.precision());
+}
@@ -0,0 +1,158 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015, 2016, 2017 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Cache.h>
+#include <celero/TestFixture.h>
+#include <celero/Timer.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+	///
+	/// Restores hot-cache measurements, however a test exits.
+	///
+	struct CacheReset
+	{
+		~CacheReset()
+		{
+			celero::cache::SetMode(celero::cache::Mode::None);
+			celero::cache::SetMethod(celero::cache::Method::Flush);
+		}
+	};
+
+	class Fixture : public celero::TestFixture
+	{
+	public:
+		std::vector<celero::cache::Region> getColdCacheRegions() const override
+		{
+			this->regionRequests++;
+			return {{this->data.data(), this->data.size() * sizeof(int)}};
+		}
+
+		std::vector<int> data = std::vector<int>(1024, 1);
+		mutable int regionRequests{0};
+		int benchmarkCalls{0};
+
+	protected:
+		void UserBenchmark() override
+		{
+			this->benchmarkCalls++;
+		}
+	};
+
+	///
+	/// Spins for half a microsecond per iteration, shorter than the microsecond clock can time on its own.
+	///
+	class SpinFixture : public celero::TestFixture
+	{
+	protected:
+		void UserBenchmark() override
+		{
+			const auto start = celero::timer::GetSystemTimeNs();
+
+			while(celero::timer::GetSystemTimeNs() - start < 500)
+			{
+			}
+		}
+	};
+} // namespace
+
+TEST(Cache, GetLastLevelCacheSize)
+{
+	EXPECT_GT(celero::cache::GetLastLevelCacheSize(), 0);
+	EXPECT_EQ(celero::cache::GetLastLevelCacheSize(), celero::cache::GetLastLevelCacheSize());
+}
+
+TEST(Cache, Settings)
+{
+	CacheReset reset;
+
+	EXPECT_EQ(celero::cache::Mode::None, celero::cache::GetMode());
+	celero::cache::SetMode(celero::cache::Mode::Iteration);
+	EXPECT_EQ(celero::cache::Mode::Iteration, celero::cache::GetMode());
+
+	EXPECT_EQ(celero::cache::Method::Flush, celero::cache::GetMethod());
+	celero::cache::SetMethod(celero::cache::Method::Evict);
+	EXPECT_EQ(celero::cache::Method::Evict, celero::cache::GetMethod());
+}
+
+TEST(Cache, FlushAndEvict)
+{
+	std::vector<int> data(4096, 1);
+
+	EXPECT_NO_THROW(celero::cache::Flush());
+	EXPECT_NO_THROW(celero::cache::Evict(data.data(), data.size() * sizeof(int)));
+	EXPECT_NO_THROW(celero::cache::Evict(nullptr, 0));
+
+	// Evicting must not change the data.
+	EXPECT_EQ(1, data.front());
+	EXPECT_EQ(1, data.back());
+}
+
+TEST(Cache, HotByDefault)
+{
+	Fixture fixture;
+	fixture.run(1, 10, nullptr);
+
+	EXPECT_EQ(10, fixture.benchmarkCalls);
+	EXPECT_EQ(0, fixture.regionRequests);
+}
+
+TEST(Cache, ColdPerSample)
+{
+	CacheReset reset;
+	celero::cache::SetMode(celero::cache::Mode::Sample);
+	celero::cache::SetMethod(celero::cache::Method::Evict);
+
+	Fixture fixture;
+	fixture.run(1, 10, nullptr);
+
+	EXPECT_EQ(10, fixture.benchmarkCalls);
+	EXPECT_EQ(1, fixture.regionRequests);
+}
+
+TEST(Cache, ColdPerIteration)
+{
+	CacheReset reset;
+	celero::cache::SetMode(celero::cache::Mode::Iteration);
+	celero::cache::SetMethod(celero::cache::Method::Evict);
+
+	Fixture fixture;
+	fixture.run(1, 10, nullptr);
+
+	// Once after setUp and once after every iteration.
+	EXPECT_EQ(10, fixture.benchmarkCalls);
+	EXPECT_EQ(11, fixture.regionRequests);
+	EXPECT_EQ(uint64_t(10), fixture.getExperimentIterations());
+}
+
+TEST(Cache, ColdPerIterationTimesSubMicrosecondIterations)
+{
+	CacheReset reset;
+	celero::cache::SetMode(celero::cache::Mode::Iteration);
+
+	SpinFixture fixture;
+	const auto sampleTime = fixture.run(1, 1000, nullptr);
+
+	// 1000 iterations of at least 500ns each, summed in nanoseconds rather than as whole microseconds per iteration.
+	EXPECT_GE(sampleTime, uint64_t(400));
+	EXPECT_LT(sampleTime, uint64_t(50000));
+	EXPECT_EQ(sampleTime, fixture.getExperimentTime());
+}
@@ -80,3 +80,26 @@ TEST(Callbacks, ExperimentResultCompleteInvalidInput)
 	celero::AddExperimentResultCompleteFunction(validFunction);
 	EXPECT_NO_THROW(celero::impl::ExperimentResultComplete(nullptr)); // Trigger with null
 }
+
+TEST(Callbacks, ExperimentResultStart)
+{
+	EXPECT_NO_THROW(celero::impl::ExperimentResultStart(nullptr));
+
+	// Callbacks stay registered for the remaining tests, so they must not refer to locals.
+	static auto calls = 0;
+	celero::AddExperimentResultStartFunction([](std::shared_ptr<celero::ExperimentResult>) { calls++; });
+
+	const auto before = calls;
+	EXPECT_NO_THROW(celero::impl::ExperimentResultStart(nullptr));
+	EXPECT_EQ(before + 1, calls);
+}
+
+TEST(Callbacks, SampleComplete)
+{
+	EXPECT_NO_THROW(celero::impl::SampleComplete(nullptr, 0));
+
+	static uint64_t sampleTime = 0;
+	celero::AddSampleCompleteFunction([](std::shared_ptr<celero::ExperimentResult>, uint64_t x) { sampleTime = x; });
+	EXPECT_NO_THROW(celero::impl::SampleComplete(nullptr, 42));
+	EXPECT_EQ(uint64_t(42), sampleTime);
+}
@@ -82,3 +82,20 @@ TEST(Celero, BuildDistribution)
 	const auto dist = celero::BuildDistribution(10, 10);
 	EXPECT_EQ(size_t(10), dist.size());
 }
+
+TEST(Celero, RegressionThresholdRequiresArchive)
+{
+	char program[] = "celero-test";
+	char threshold[] = "--regressionThreshold=5";
+	char* argv[] = {program, threshold, nullptr};
+
+	// Without an archive nothing can be compared, so the run must fail rather than silently pass.
+	testing::internal::CaptureStdout();
+	testing::internal::CaptureStderr();
+	const auto result = celero::Run(2, argv);
+	testing::internal::GetCapturedStdout();
+	const auto error = testing::internal::GetCapturedStderr();
+
+	EXPECT_NE(0, result);
+	EXPECT_NE(std::string::npos, error.find("--archive"));
+}
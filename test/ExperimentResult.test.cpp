@@ -64,3 +64,38 @@ TEST(ExperimentResult, getUnitsPerSecondWithValidSpace)
 	result.addRunTimeSample(1000);
 	EXPECT_GT(result.getUnitsPerSecond(), 0.0);
 }
+
+TEST(ExperimentResult, warmupSamplesAreSeparate)
+{
+	celero::ExperimentResult result(nullptr);
+	EXPECT_EQ(uint64_t(0), result.getWarmupFirstRunTime());
+
+	result.addWarmupSample(90);
+	result.addWarmupSample(30);
+	result.addRunTimeSample(10);
+
+	EXPECT_EQ(uint64_t(90), result.getWarmupFirstRunTime());
+	EXPECT_EQ(size_t(2), result.getWarmupStatistics().getSize());
+	EXPECT_DOUBLE_EQ(60.0, result.getWarmupStatistics().getMean());
+	EXPECT_EQ(size_t(1), result.getTimeStatistics().getSize());
+	EXPECT_EQ(uint64_t(10), result.getRunTime());
+}
+
+TEST(ExperimentResult, throughputFromPerIterationCounts)
+{
+	celero::ExperimentResult result(nullptr);
+	auto ev = std::make_shared<celero::TestFixture::ExperimentValue>(0, 10);
+	result.setProblemSpaceValue(ev);
+	result.addRunTimeSample(1000);
+
+	EXPECT_DOUBLE_EQ(0.0, result.getBytesPerSecond());
+	EXPECT_DOUBLE_EQ(0.0, result.getItemsPerSecond());
+
+	result.setBytesPerIteration(64);
+	result.setItemsPerIteration(4);
+
+	EXPECT_EQ(int64_t(64), result.getBytesPerIteration());
+	EXPECT_EQ(int64_t(4), result.getItemsPerIteration());
+	EXPECT_DOUBLE_EQ(64.0 * result.getCallsPerSecond(), result.getBytesPerSecond());
+	EXPECT_DOUBLE_EQ(4.0 * result.getCallsPerSecond(), result.getItemsPerSecond());
+}
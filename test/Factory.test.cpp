@@ -0,0 +1,151 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015, 2016, 2017 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Experiment.h>
+#include <celero/GenericFactory.h>
+#include <celero/UserDefinedMeasurementTemplate.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+	class CountingUDM : public celero::UserDefinedMeasurementTemplate<int>
+	{
+	public:
+		std::string getName() const override
+		{
+			return "count";
+		}
+	};
+
+	class CountingFixture : public celero::TestFixture
+	{
+	public:
+		CountingFixture()
+		{
+			Constructions++;
+		}
+
+		std::vector<std::shared_ptr<celero::TestFixture::ExperimentValue>> getExperimentValues() const override
+		{
+			return {std::make_shared<celero::TestFixture::ExperimentValue>(8), std::make_shared<celero::TestFixture::ExperimentValue>(16)};
+		}
+
+		double getExperimentValueResultScale() const override
+		{
+			return 1024.0;
+		}
+
+		FixtureLifetime getFixtureLifetime() const override
+		{
+			return FixtureLifetime::PerProblemSpace;
+		}
+
+		int64_t getBytesPerIteration(const celero::TestFixture::ExperimentValue* const x) const override
+		{
+			return (x != nullptr) ? x->Value * 4 : 0;
+		}
+
+		std::vector<std::shared_ptr<celero::UserDefinedMeasurement>> getUserDefinedMeasurements() const override
+		{
+			return {this->udm};
+		}
+
+		static int Constructions;
+
+	private:
+		std::shared_ptr<CountingUDM> udm{std::make_shared<CountingUDM>()};
+	};
+
+	int CountingFixture::Constructions = 0;
+
+	class NullFactory : public celero::Factory
+	{
+	public:
+		std::shared_ptr<celero::TestFixture> Create() override
+		{
+			return nullptr;
+		}
+	};
+} // namespace
+
+TEST(Factory, MetadataIsCached)
+{
+	celero::GenericFactory<CountingFixture> factory;
+	CountingFixture::Constructions = 0;
+
+	// Nothing is constructed until metadata is needed.
+	EXPECT_EQ(0, CountingFixture::Constructions);
+
+	ASSERT_TRUE(factory.getIsValid());
+	EXPECT_EQ(1, CountingFixture::Constructions);
+
+	const auto& values = factory.getExperimentValues();
+	ASSERT_EQ(size_t(2), values.size());
+	EXPECT_EQ(int64_t(8), values[0]->Value);
+	EXPECT_EQ(int64_t(16), values[1]->Value);
+	EXPECT_DOUBLE_EQ(1024.0, factory.getExperimentValueResultScale());
+	EXPECT_EQ(celero::TestFixture::FixtureLifetime::PerProblemSpace, factory.getFixtureLifetime());
+	EXPECT_TRUE(factory.getReportsBytes());
+	EXPECT_FALSE(factory.getReportsItems());
+
+	ASSERT_EQ(size_t(1), factory.getUserDefinedMeasurementNames().size());
+	EXPECT_EQ(std::string("count"), factory.getUserDefinedMeasurementNames()[0]);
+	EXPECT_FALSE(factory.getUserDefinedMeasurementFields().empty());
+
+	// The same problem space instances are returned each time.
+	EXPECT_EQ(values[0], factory.getExperimentValues()[0]);
+
+	EXPECT_EQ(1, CountingFixture::Constructions);
+}
+
+TEST(Factory, NullFixture)
+{
+	NullFactory factory;
+
+	EXPECT_FALSE(factory.getIsValid());
+	EXPECT_TRUE(factory.getExperimentValues().empty());
+	EXPECT_TRUE(factory.getUserDefinedMeasurementNames().empty());
+	EXPECT_TRUE(factory.getUserDefinedMeasurementFields().empty());
+}
+
+TEST(Factory, FixtureLifetime)
+{
+	using Lifetime = celero::TestFixture::FixtureLifetime;
+
+	celero::Experiment experiment{std::weak_ptr<celero::Benchmark>()};
+	EXPECT_EQ(Lifetime::PerSample, experiment.getFixtureLifetime());
+
+	// The fixture's choice overrides the default.
+	experiment.setFactory(std::make_shared<celero::GenericFactory<CountingFixture>>());
+	EXPECT_EQ(Lifetime::PerProblemSpace, experiment.getFixtureLifetime());
+
+	// The experiment's choice overrides the fixture's.
+	experiment.setFixtureLifetime(Lifetime::PerExperiment);
+	EXPECT_EQ(Lifetime::PerExperiment, experiment.getFixtureLifetime());
+
+	// The default is used when nobody chooses.
+	celero::Experiment other{std::weak_ptr<celero::Benchmark>()};
+	celero::Experiment::SetDefaultFixtureLifetime(Lifetime::PerExperiment);
+	EXPECT_EQ(Lifetime::PerExperiment, other.getFixtureLifetime());
+
+	celero::Experiment::SetDefaultFixtureLifetime(Lifetime::Default);
+	EXPECT_EQ(Lifetime::PerExperiment, celero::Experiment::GetDefaultFixtureLifetime());
+
+	celero::Experiment::SetDefaultFixtureLifetime(Lifetime::PerSample);
+	EXPECT_EQ(Lifetime::PerSample, other.getFixtureLifetime());
+}
@@ -0,0 +1,146 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015, 2016, 2017 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Filter.h>
+#include <celero/TestFixture.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+	///
+	/// Leaves the singleton without patterns, however a test exits.
+	///
+	struct FilterReset
+	{
+		FilterReset()
+		{
+			celero::Filter::Instance().clear();
+		}
+
+		~FilterReset()
+		{
+			celero::Filter::Instance().clear();
+		}
+	};
+
+	const auto NoProblemSpace = static_cast<int64_t>(celero::TestFixture::Constants::NoProblemSpaceValue);
+} // namespace
+
+TEST(Filter, Inactive)
+{
+	FilterReset reset;
+	auto& filter = celero::Filter::Instance();
+
+	EXPECT_FALSE(filter.isActive());
+	EXPECT_TRUE(filter.matches("Group", "Experiment"));
+	EXPECT_TRUE(filter.matches("Group", "Experiment", 42));
+}
+
+TEST(Filter, Glob)
+{
+	FilterReset reset;
+	auto& filter = celero::Filter::Instance();
+
+	EXPECT_TRUE(filter.addInclude("Sort.Quick*"));
+	EXPECT_TRUE(filter.isActive());
+
+	EXPECT_TRUE(filter.matches("Sort", "Quick"));
+	EXPECT_TRUE(filter.matches("Sort", "QuickInPlace"));
+	EXPECT_FALSE(filter.matches("Sort", "Merge"));
+	EXPECT_FALSE(filter.matches("Search", "Quick"));
+
+	filter.clear();
+	EXPECT_TRUE(filter.addInclude("*.Qu?ck"));
+	EXPECT_TRUE(filter.matches("Sort", "Quick"));
+	EXPECT_TRUE(filter.matches("Search", "Quack"));
+	EXPECT_FALSE(filter.matches("Sort", "Quickest"));
+}
+
+TEST(Filter, Regex)
+{
+	FilterReset reset;
+	auto& filter = celero::Filter::Instance();
+
+	EXPECT_TRUE(filter.addInclude("regex:Sort\\.(Quick|Merge)"));
+	EXPECT_TRUE(filter.matches("Sort", "Quick"));
+	EXPECT_TRUE(filter.matches("Sort", "Merge"));
+	EXPECT_FALSE(filter.matches("Sort", "Heap"));
+
+	// The whole name must match.
+	EXPECT_FALSE(filter.matches("Sort", "QuickInPlace"));
+
+	EXPECT_FALSE(filter.addInclude("regex:Sort("));
+}
+
+TEST(Filter, ProblemSpace)
+{
+	FilterReset reset;
+	auto& filter = celero::Filter::Instance();
+
+	EXPECT_TRUE(filter.addInclude("Sort.*/1?24"));
+
+	// The experiment may still have matching problem spaces.
+	EXPECT_TRUE(filter.matches("Sort", "Quick"));
+
+	EXPECT_TRUE(filter.matches("Sort", "Quick", 1024));
+	EXPECT_FALSE(filter.matches("Sort", "Quick", 2048));
+	EXPECT_FALSE(filter.matches("Sort", "Quick", NoProblemSpace));
+
+	filter.clear();
+	EXPECT_TRUE(filter.addInclude("Sort.Quick/Null"));
+	EXPECT_TRUE(filter.matches("Sort", "Quick", NoProblemSpace));
+	EXPECT_FALSE(filter.matches("Sort", "Quick", 0));
+}
+
+TEST(Filter, ProblemSpaceParameters)
+{
+	FilterReset reset;
+	auto& filter = celero::Filter::Instance();
+
+	celero::TestFixture::ExperimentValue x(64);
+	x.Parameters = {{"size", 64}, {"threads", 4}};
+
+	celero::TestFixture::ExperimentValue y(64);
+	y.Parameters = {{"size", 64}, {"threads", 8}};
+
+	EXPECT_TRUE(filter.addInclude("Sort.Quick/*threads=4"));
+	EXPECT_TRUE(filter.matches("Sort", "Quick", x));
+	EXPECT_FALSE(filter.matches("Sort", "Quick", y));
+}
+
+TEST(Filter, Exclude)
+{
+	FilterReset reset;
+	auto& filter = celero::Filter::Instance();
+
+	EXPECT_TRUE(filter.addExclude("*.Heap"));
+	EXPECT_TRUE(filter.addExclude("Sort.Quick/2048"));
+
+	EXPECT_FALSE(filter.matches("Sort", "Heap"));
+	EXPECT_FALSE(filter.matches("Sort", "Heap", 1024));
+
+	// Excluding one problem space keeps the rest of the experiment.
+	EXPECT_TRUE(filter.matches("Sort", "Quick"));
+	EXPECT_TRUE(filter.matches("Sort", "Quick", 1024));
+	EXPECT_FALSE(filter.matches("Sort", "Quick", 2048));
+
+	// Exclusions apply after inclusions.
+	EXPECT_TRUE(filter.addInclude("Sort.*"));
+	EXPECT_TRUE(filter.matches("Sort", "Merge"));
+	EXPECT_FALSE(filter.matches("Sort", "Heap"));
+}
@@ -0,0 +1,170 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/InputPool.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+	using Pool = celero::InputPool<std::vector<int>>;
+
+	///
+	/// Fills each batch with its index and counts how often batches were generated.
+	///
+	Pool::Generator CountingGenerator(size_t& generated)
+	{
+		return [&generated](std::vector<int>& batch, size_t index) {
+			batch.assign(4, static_cast<int>(index));
+			++generated;
+		};
+	}
+} // namespace
+
+TEST(InputPool, reset)
+{
+	size_t generated = 0;
+	Pool pool;
+
+	pool.reset(CountingGenerator(generated), 3);
+	EXPECT_EQ(size_t(3), pool.size());
+	EXPECT_EQ(size_t(3), generated);
+	EXPECT_EQ(size_t(0), pool.getUsed());
+
+	pool.reset(CountingGenerator(generated), 0);
+	EXPECT_EQ(size_t(1), pool.size());
+}
+
+TEST(InputPool, nextCycles)
+{
+	size_t generated = 0;
+	Pool pool;
+	pool.reset(CountingGenerator(generated), 3);
+
+	EXPECT_EQ(0, pool.next()[0]);
+	EXPECT_EQ(1, pool.next()[0]);
+	EXPECT_EQ(2, pool.next()[0]);
+	EXPECT_EQ(0, pool.next()[0]);
+	EXPECT_EQ(size_t(4), pool.getUsed());
+	EXPECT_EQ(size_t(3), generated);
+}
+
+TEST(InputPool, refillRegeneratesUsedBatches)
+{
+	size_t generated = 0;
+	Pool pool;
+	pool.reset(CountingGenerator(generated), 4);
+	generated = 0;
+
+	// Consume two batches.
+	pool.next().clear();
+	pool.next().clear();
+
+	pool.refill();
+	EXPECT_EQ(size_t(2), generated);
+	EXPECT_EQ(size_t(0), pool.getUsed());
+
+	for(int i = 0; i < 4; ++i)
+	{
+		const auto& batch = pool.next();
+		ASSERT_EQ(size_t(4), batch.size());
+		EXPECT_EQ(i, batch[0]);
+	}
+
+	// After wrapping, every batch is regenerated, but only once.
+	pool.next();
+	generated = 0;
+	pool.refill();
+	EXPECT_EQ(size_t(4), generated);
+}
+
+TEST(InputPool, refillInBackground)
+{
+	size_t generated = 0;
+	Pool pool;
+	pool.reset(CountingGenerator(generated), 3);
+
+	pool.next().clear();
+	pool.next().clear();
+	pool.next().clear();
+
+	generated = 0;
+	pool.refillInBackground();
+
+	// A second request while one is pending does nothing.
+	pool.refillInBackground();
+
+	pool.refill();
+	EXPECT_EQ(size_t(3), generated);
+
+	for(int i = 0; i < 3; ++i)
+	{
+		const auto& batch = pool.next();
+		ASSERT_EQ(size_t(4), batch.size());
+		EXPECT_EQ(i, batch[0]);
+	}
+}
+
+TEST(InputPool, backgroundGeneratorThrows)
+{
+	bool fail = false;
+
+	const auto generator = [&fail](std::vector<int>& batch, size_t) {
+		if(fail == true)
+		{
+			throw std::runtime_error("generator failed");
+		}
+
+		batch.assign(4, 0);
+	};
+
+	// refill() reports the failure to the caller.
+	{
+		Pool pool;
+		pool.reset(generator, 2);
+		fail = true;
+		pool.refillInBackground();
+		EXPECT_THROW(pool.refill(), std::runtime_error);
+	}
+
+	// Destroying a pool with a failed refill still pending must not terminate the process.
+	{
+		fail = false;
+		Pool pool;
+		pool.reset(generator, 2);
+		fail = true;
+		pool.refillInBackground();
+	}
+}
+
+TEST(InputPool, BatchesFor)
+{
+	const auto llc = static_cast<size_t>(celero::cache::GetLastLevelCacheSize());
+
+	const auto inCache = Pool::BatchesFor(1024, Pool::Residency::InCache);
+	EXPECT_LE(inCache * 1024, llc / 2);
+
+	const auto outOfCache = Pool::BatchesFor(1024, Pool::Residency::OutOfCache);
+	EXPECT_GT(outOfCache * 1024, llc * 2);
+
+	// A batch larger than the cache still yields the minimum.
+	EXPECT_EQ(size_t(1), Pool::BatchesFor(llc, Pool::Residency::InCache));
+	EXPECT_EQ(size_t(8), Pool::BatchesFor(llc, Pool::Residency::InCache, 8));
+}
@@ -0,0 +1,111 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015, 2016, 2017 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Benchmark.h>
+#include <celero/Experiment.h>
+#include <celero/ExperimentResult.h>
+#include <celero/JSON.h>
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+TEST(JSON, Instance)
+{
+	EXPECT_NO_THROW(celero::JSON::Instance());
+}
+
+TEST(JSON, SerializeEnvironment)
+{
+	std::stringstream ss;
+	celero::JSON::SerializeEnvironment(ss);
+
+	const auto x = ss.str();
+	EXPECT_EQ('{', x.front());
+	EXPECT_EQ('}', x.back());
+	EXPECT_NE(std::string::npos, x.find("\"compiler\":"));
+	EXPECT_NE(std::string::npos, x.find("\"timerResolutionUs\":"));
+}
+
+TEST(JSON, Serialize)
+{
+	auto benchmark = std::make_shared<celero::Benchmark>("Group \"Quoted\"");
+	auto experiment = std::make_shared<celero::Experiment>(benchmark, "Experiment", 1, 10, 1, 0.0);
+	experiment->setIsBaselineCase(true);
+	benchmark->addExperiment(experiment);
+
+	auto result = std::make_shared<celero::ExperimentResult>(experiment.get());
+	result->setProblemSpaceValue(std::make_shared<celero::TestFixture::ExperimentValue>(64, 10));
+	result->addRunTimeSample(100);
+
+	std::stringstream ss;
+	celero::JSON::Serialize(ss, result);
+
+	const auto x = ss.str();
+	EXPECT_EQ(std::string::npos, x.find('\n'));
+	EXPECT_NE(std::string::npos, x.find("\"group\":\"Group \\\"Quoted\\\"\""));
+	EXPECT_NE(std::string::npos, x.find("\"problemSpace\":{\"value\":64,\"scale\":1,\"iterations\":10}"));
+	EXPECT_NE(std::string::npos, x.find("\"usPerIteration\":10,"));
+	EXPECT_NE(std::string::npos, x.find("\"userDefined\":{}"));
+}
+
+TEST(JSON, SerializeParameters)
+{
+	auto benchmark = std::make_shared<celero::Benchmark>("Group");
+	auto experiment = std::make_shared<celero::Experiment>(benchmark, "Experiment", 1, 10, 1, 0.0);
+	experiment->setIsBaselineCase(true);
+	benchmark->addExperiment(experiment);
+
+	auto ps = std::make_shared<celero::TestFixture::ExperimentValue>(64, 10);
+	ps->Parameters = {{"size", 64}, {"threads", 4}};
+
+	auto result = std::make_shared<celero::ExperimentResult>(experiment.get());
+	result->setProblemSpaceValue(ps);
+	result->addRunTimeSample(100);
+
+	std::stringstream ss;
+	celero::JSON::Serialize(ss, result);
+
+	const auto x = ss.str();
+	EXPECT_NE(std::string::npos, x.find("\"iterations\":10,\"parameters\":{\"size\":64,\"threads\":4}}"));
+}
+
+TEST(JSON, SerializeThroughput)
+{
+	auto benchmark = std::make_shared<celero::Benchmark>("Group");
+	auto experiment = std::make_shared<celero::Experiment>(benchmark, "Experiment", 1, 10, 1, 0.0);
+	experiment->setIsBaselineCase(true);
+	benchmark->addExperiment(experiment);
+
+	auto result = std::make_shared<celero::ExperimentResult>(experiment.get());
+	result->setProblemSpaceValue(std::make_shared<celero::TestFixture::ExperimentValue>(64, 10));
+	result->addRunTimeSample(100);
+	result->setBytesPerIteration(1000);
+	result->setItemsPerIteration(2);
+
+	std::stringstream ss;
+	celero::JSON::Serialize(ss, result);
+
+	const auto x = ss.str();
+	EXPECT_NE(std::string::npos, x.find("\"bytesPerIteration\":1000,\"itemsPerIteration\":2,\"bytesPerSecond\":"));
+
+	// 100 us over 10 iterations is 100,000 iterations per second.
+	const auto bytesPerSecond = x.find("\"bytesPerSecond\":") + std::string("\"bytesPerSecond\":").size();
+	const auto itemsPerSecond = x.find("\"itemsPerSecond\":") + std::string("\"itemsPerSecond\":").size();
+	EXPECT_NEAR(1.0e8, std::stod(x.substr(bytesPerSecond)), 1.0);
+	EXPECT_NEAR(2.0e5, std::stod(x.substr(itemsPerSecond)), 0.01);
+}
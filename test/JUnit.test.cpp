@@ -0,0 +1,158 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Benchmark.h>
+#include <celero/Experiment.h>
+#include <celero/ExperimentResult.h>
+#include <celero/JUnit.h>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace
+{
+	std::string ReadFile(const std::string& fileName)
+	{
+		std::ifstream ifs(fileName, std::ifstream::binary);
+		return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+	}
+
+	bool FileExists(const std::string& fileName)
+	{
+		return std::ifstream(fileName).good();
+	}
+
+	size_t Count(const std::string& x, const std::string& pattern)
+	{
+		size_t count = 0;
+
+		for(auto i = x.find(pattern); i != std::string::npos; i = x.find(pattern, i + pattern.size()))
+		{
+			++count;
+		}
+
+		return count;
+	}
+
+	std::shared_ptr<celero::ExperimentResult> MakeResult(std::shared_ptr<celero::Experiment> experiment, int64_t value)
+	{
+		auto result = std::make_shared<celero::ExperimentResult>(experiment.get());
+		result->setProblemSpaceValue(std::make_shared<celero::TestFixture::ExperimentValue>(value, 10));
+		result->addRunTimeSample(100);
+		result->addRunTimeSample(120);
+		return result;
+	}
+} // namespace
+
+TEST(JUnit, structureAndEscaping)
+{
+	const std::string fileName{"JUnitStructure.xml"};
+	std::remove(fileName.c_str());
+
+	auto benchmark = std::make_shared<celero::Benchmark>("Group<&>");
+	auto experiment = std::make_shared<celero::Experiment>(benchmark, "Experiment\"'", 2, 10, 1, 0.0);
+	experiment->setIsBaselineCase(true);
+	benchmark->addExperiment(experiment);
+
+	auto failed = MakeResult(experiment, 128);
+	failed->setFailure(true);
+
+	celero::JUnit::Instance().setFileName(fileName);
+	celero::JUnit::Instance().add(MakeResult(experiment, 64));
+	celero::JUnit::Instance().add(failed);
+	celero::JUnit::Instance().save();
+
+	const auto xml = ReadFile(fileName);
+	ASSERT_FALSE(xml.empty());
+
+	EXPECT_EQ(0u, xml.find("<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n<testsuites>\n"));
+	EXPECT_EQ(xml.size() - std::string("</testsuites>\n").size(), xml.rfind("</testsuites>\n"));
+
+	// Both results land in one testsuite named after the escaped group.
+	const auto suiteBegin = xml.find("<testsuite errors=\"1\" tests=\"2\" ");
+	ASSERT_NE(std::string::npos, suiteBegin);
+	const auto suiteEnd = xml.find("</testsuite>\n", suiteBegin);
+	ASSERT_NE(std::string::npos, suiteEnd);
+	const auto suite = xml.substr(suiteBegin, suiteEnd - suiteBegin);
+
+	EXPECT_NE(std::string::npos, suite.find("failures=\"0\" name=\"Group&lt;&amp;&gt;\">\n"));
+	EXPECT_EQ(size_t(2), Count(suite, "<testcase "));
+	EXPECT_EQ(size_t(2), Count(suite, "</testcase>\n"));
+	EXPECT_NE(std::string::npos, suite.find("name=\"Experiment&quot;&apos;#64\">\n"));
+	EXPECT_NE(std::string::npos, suite.find("name=\"Experiment&quot;&apos;#128\">\n"));
+
+	// Only the successful result carries measurements; the failed one is reported as an error.
+	EXPECT_EQ(size_t(1), Count(suite, "<properties>"));
+	EXPECT_EQ(size_t(1), Count(suite, "<error type=\"exception\"/>"));
+	EXPECT_NE(std::string::npos, suite.find("<property name=\"samples\" value=\"2\"/>"));
+
+	EXPECT_EQ(std::string::npos, xml.find("Group<"));
+	EXPECT_EQ(std::string::npos, xml.find("Experiment\""));
+
+	std::remove(fileName.c_str());
+}
+
+TEST(JUnit, saveReplacesFile)
+{
+	const std::string fileName{"JUnitReplace.xml"};
+	const std::string previousFileName{"JUnitReplace.previous.xml"};
+	std::remove(fileName.c_str());
+	std::remove(previousFileName.c_str());
+
+	auto benchmark = std::make_shared<celero::Benchmark>("ReplaceGroup");
+	auto experiment = std::make_shared<celero::Experiment>(benchmark, "Experiment", 2, 10, 1, 0.0);
+	experiment->setIsBaselineCase(true);
+	benchmark->addExperiment(experiment);
+
+	celero::JUnit::Instance().setFileName(fileName);
+	celero::JUnit::Instance().add(MakeResult(experiment, 64));
+	celero::JUnit::Instance().save();
+
+	const auto first = ReadFile(fileName);
+	EXPECT_NE(std::string::npos, first.find("name=\"Experiment#64\""));
+	EXPECT_EQ(std::string::npos, first.find("name=\"Experiment#128\""));
+	EXPECT_FALSE(FileExists(fileName + ".tmp"));
+
+#ifndef _WIN32
+	// A second name for the first document.  Rewriting the file in place would change it too; replacing the file leaves it alone.
+	ASSERT_EQ(0, link(fileName.c_str(), previousFileName.c_str()));
+#endif
+
+	celero::JUnit::Instance().add(MakeResult(experiment, 128));
+	celero::JUnit::Instance().save();
+
+	const auto second = ReadFile(fileName);
+	EXPECT_NE(std::string::npos, second.find("name=\"Experiment#64\""));
+	EXPECT_NE(std::string::npos, second.find("name=\"Experiment#128\""));
+	EXPECT_NE(std::string::npos, second.find("</testsuites>\n"));
+	EXPECT_FALSE(FileExists(fileName + ".tmp"));
+
+#ifndef _WIN32
+	EXPECT_EQ(first, ReadFile(previousFileName));
+#endif
+
+	std::remove(fileName.c_str());
+	std::remove(previousFileName.c_str());
+}
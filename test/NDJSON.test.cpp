@@ -0,0 +1,72 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Benchmark.h>
+#include <celero/Experiment.h>
+#include <celero/ExperimentResult.h>
+#include <celero/NDJSON.h>
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <string>
+
+TEST(NDJSON, StandardOutputOnlyHoldsResults)
+{
+	auto benchmark = std::make_shared<celero::Benchmark>("Group");
+	auto experiment = std::make_shared<celero::Experiment>(benchmark, "Experiment", 1, 10, 1, 0.0);
+	experiment->setIsBaselineCase(true);
+	benchmark->addExperiment(experiment);
+
+	auto result = std::make_shared<celero::ExperimentResult>(experiment.get());
+	result->setProblemSpaceValue(std::make_shared<celero::TestFixture::ExperimentValue>(64, 10));
+	result->addRunTimeSample(100);
+
+	testing::internal::CaptureStdout();
+	testing::internal::CaptureStderr();
+
+	celero::NDJSON::Instance().setFileName("-");
+	std::cout << "Console table" << std::endl;
+	celero::NDJSON::Instance().add(result);
+	std::cout << "Completed" << std::endl;
+	celero::NDJSON::Instance().add(result);
+	celero::NDJSON::Instance().closeFile();
+
+	const auto stdOut = testing::internal::GetCapturedStdout();
+	const auto stdErr = testing::internal::GetCapturedStderr();
+
+	// Two lines, each a complete JSON object.
+	const auto firstEnd = stdOut.find('\n');
+	ASSERT_NE(std::string::npos, firstEnd);
+	EXPECT_EQ(0u, stdOut.find("{\"environment\":{"));
+	EXPECT_EQ('}', stdOut[firstEnd - 1]);
+	EXPECT_EQ(stdOut.substr(0, firstEnd + 1), stdOut.substr(firstEnd + 1));
+	EXPECT_EQ(std::string::npos, stdOut.find("Console table"));
+
+	EXPECT_EQ(std::string("Console table\nCompleted\n"), stdErr);
+}
+
+TEST(NDJSON, CloseRestoresStandardOutput)
+{
+	testing::internal::CaptureStdout();
+
+	celero::NDJSON::Instance().setFileName("-");
+	celero::NDJSON::Instance().closeFile();
+	std::cout << "Console" << std::endl;
+
+	EXPECT_EQ(std::string("Console\n"), testing::internal::GetCapturedStdout());
+}
@@ -0,0 +1,149 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Benchmark.h>
+#include <celero/Experiment.h>
+#include <celero/ExperimentResult.h>
+#include <celero/Print.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace
+{
+	size_t Count(const std::string& x, const std::string& pattern)
+	{
+		size_t count = 0;
+
+		for(auto i = x.find(pattern); i != std::string::npos; i = x.find(pattern, i + pattern.size()))
+		{
+			++count;
+		}
+
+		return count;
+	}
+
+	///
+	/// A group with one experiment and a result for it, as the executor would produce.
+	///
+	struct PrintFixture
+	{
+		PrintFixture()
+		{
+			this->experiment->setIsBaselineCase(true);
+			this->benchmark->addExperiment(this->experiment);
+
+			this->result->setProblemSpaceValue(std::make_shared<celero::TestFixture::ExperimentValue>(64, 10));
+			this->result->setBytesPerIteration(1024);
+			this->result->setItemsPerIteration(1);
+			this->result->addRunTimeSample(100);
+		}
+
+		std::shared_ptr<celero::Benchmark> benchmark{std::make_shared<celero::Benchmark>("PrintGroup")};
+		std::shared_ptr<celero::Experiment> experiment{std::make_shared<celero::Experiment>(benchmark, "PrintExperiment", 3, 10, 1, 0.0)};
+		std::shared_ptr<celero::ExperimentResult> result{std::make_shared<celero::ExperimentResult>(experiment.get())};
+	};
+} // namespace
+
+TEST(Print, table)
+{
+	PrintFixture fixture;
+	auto& printer = celero::Printer::get();
+
+	printer.initialize({"udm"});
+	printer.setThroughputColumns(true, true);
+	printer.setBinaryUnits(true);
+
+	testing::internal::CaptureStdout();
+	printer.TableBanner();
+	const auto banner = testing::internal::GetCapturedStdout();
+
+	// The header row and the rule beneath it, with the throughput and user-defined columns.
+	EXPECT_EQ(size_t(2), Count(banner, "\n"));
+	EXPECT_NE(std::string::npos, banner.find("Group"));
+	EXPECT_NE(std::string::npos, banner.find("us/Iteration"));
+	EXPECT_NE(std::string::npos, banner.find("Bytes/sec"));
+	EXPECT_NE(std::string::npos, banner.find("Items/sec"));
+	EXPECT_NE(std::string::npos, banner.find("udm"));
+	EXPECT_EQ(size_t(12), Count(banner.substr(banner.find('\n')), ":|"));
+
+	// Nothing is written while the row is being built.
+	testing::internal::CaptureStdout();
+	printer.TableRowHeader(fixture.result);
+	EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+
+	testing::internal::CaptureStdout();
+	printer.TableResult(fixture.result);
+	const auto row = testing::internal::GetCapturedStdout();
+
+	EXPECT_EQ(size_t(1), Count(row, "\n"));
+	EXPECT_NE(std::string::npos, row.find("|PrintGroup"));
+	EXPECT_NE(std::string::npos, row.find("PrintExperiment"));
+	EXPECT_NE(std::string::npos, row.find("MiB/s"));
+	EXPECT_NE(std::string::npos, row.find("kitems/s"));
+	EXPECT_NE(std::string::npos, row.find("---"));
+
+	// A failed experiment completes its row with placeholders and the message.
+	testing::internal::CaptureStdout();
+	printer.TableRowHeader(fixture.result);
+	printer.TableRowFailure("Failure");
+	const auto failure = testing::internal::GetCapturedStdout();
+
+	EXPECT_EQ(size_t(1), Count(failure, "\n"));
+	EXPECT_NE(std::string::npos, failure.find("PrintExperiment"));
+	EXPECT_NE(std::string::npos, failure.find("Failure"));
+	EXPECT_EQ(size_t(6), Count(failure, "- | "));
+
+	printer.initialize({});
+	printer.setThroughputColumns(false, false);
+	printer.setBinaryUnits(false);
+}
+
+TEST(Print, progress)
+{
+	PrintFixture fixture;
+	auto& printer = celero::Printer::get();
+
+	printer.setMode(celero::Printer::Mode::Progress);
+	printer.setProgressTotal(2);
+
+	testing::internal::CaptureStdout();
+
+	printer.TableBanner();
+	printer.TableRowHeader(fixture.result);
+	printer.TableResult(fixture.result);
+	printer.TableRowHeader(fixture.result);
+	printer.TableRowFailure("Failure");
+	printer.ExperimentComplete(fixture.experiment);
+	printer.ProgressComplete();
+
+	const auto output = testing::internal::GetCapturedStdout();
+	printer.setMode(celero::Printer::Mode::Table);
+
+	// Every update redraws the same line, and only the final one ends it.
+	EXPECT_EQ(size_t(4), Count(output, "\r["));
+	EXPECT_EQ(size_t(1), Count(output, "\n"));
+	EXPECT_EQ('\n', output.back());
+	EXPECT_EQ(std::string::npos, output.find("PrintGroup"));
+	EXPECT_EQ(std::string::npos, output.find("Failure"));
+
+	EXPECT_NE(std::string::npos, output.find("] 0/2 experiments, 0 results"));
+	EXPECT_NE(std::string::npos, output.find("] 0/2 experiments, 1 results"));
+	EXPECT_NE(std::string::npos, output.find(", 1 failed"));
+	EXPECT_NE(std::string::npos, output.find("\r[" + std::string(20, '#') + std::string(20, '.') + "] 1/2 experiments, 1 results"));
+}
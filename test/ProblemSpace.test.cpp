@@ -0,0 +1,113 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Benchmark.h>
+#include <celero/Experiment.h>
+#include <celero/ExperimentResult.h>
+#include <celero/ProblemSpace.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+
+TEST(ProblemSpace, Empty)
+{
+	celero::ProblemSpace x;
+	EXPECT_EQ(size_t(0), x.size());
+	EXPECT_TRUE(x.build().empty());
+
+	x.axis("size", {});
+	EXPECT_TRUE(x.build().empty());
+}
+
+TEST(ProblemSpace, range)
+{
+	const auto x = celero::ProblemSpace().range("size", 64, 1024).build();
+	ASSERT_EQ(size_t(5), x.size());
+	EXPECT_EQ(int64_t(64), x.front()->Value);
+	EXPECT_EQ(int64_t(1024), x.back()->Value);
+
+	const auto y = celero::ProblemSpace().range("threads", 1, 3, 1).build();
+	ASSERT_EQ(size_t(3), y.size());
+	EXPECT_EQ(int64_t(2), y[1]->Value);
+
+	// A multiplier cannot make progress from zero.
+	EXPECT_EQ(size_t(1), celero::ProblemSpace().range("x", 0, 10).size());
+}
+
+TEST(ProblemSpace, rangeToLimit)
+{
+	const auto maximum = std::numeric_limits<int64_t>::max();
+
+	// Doubling up to the limit stops at the last power of two that fits rather than overflowing.
+	const auto x = celero::ProblemSpace().range("size", 1, maximum).build();
+	ASSERT_EQ(size_t(63), x.size());
+	EXPECT_EQ(int64_t(1) << 62, x.back()->Value);
+
+	const auto y = celero::ProblemSpace().range("size", maximum - 2, maximum, 1).build();
+	ASSERT_EQ(size_t(3), y.size());
+	EXPECT_EQ(maximum, y.back()->Value);
+}
+
+TEST(ProblemSpace, CartesianProduct)
+{
+	const auto x = celero::ProblemSpace().axis("size", {64, 128}).axis("threads", {1, 2, 4}).iterations(10).build();
+	ASSERT_EQ(size_t(6), x.size());
+
+	// The last axis varies fastest, and Value follows the first axis.
+	EXPECT_EQ(std::string("size=64;threads=1"), x[0]->getParameterString());
+	EXPECT_EQ(std::string("size=64;threads=4"), x[2]->getParameterString());
+	EXPECT_EQ(std::string("size=128;threads=1"), x[3]->getParameterString());
+	EXPECT_EQ(int64_t(128), x[3]->Value);
+	EXPECT_EQ(int64_t(10), x[3]->Iterations);
+
+	EXPECT_EQ(int64_t(2), x[4]->getParameter("threads"));
+	EXPECT_EQ(int64_t(-1), x[4]->getParameter("missing", -1));
+}
+
+TEST(ProblemSpace, axisReplaces)
+{
+	const auto x = celero::ProblemSpace().axis("size", {1, 2}).axis("size", {3}).build();
+	ASSERT_EQ(size_t(1), x.size());
+	EXPECT_EQ(int64_t(3), x[0]->Value);
+}
+
+TEST(ProblemSpace, getResultByValue)
+{
+	auto benchmark = std::make_shared<celero::Benchmark>("Group");
+	auto experiment = std::make_shared<celero::Experiment>(benchmark, "Experiment", 1, 10, 1, 0.0);
+	benchmark->addExperiment(experiment);
+
+	const auto values = celero::ProblemSpace().axis("size", {64}).axis("threads", {1, 4}).build();
+
+	for(const auto& i : values)
+	{
+		experiment->addProblemSpace(i);
+	}
+
+	// Both results share Value 64, so only the full parameter tuple tells them apart.
+	celero::TestFixture::ExperimentValue lookup(64);
+	lookup.Parameters = {{"size", 64}, {"threads", 4}};
+
+	const auto r = experiment->getResultByValue(lookup);
+	ASSERT_NE(nullptr, r);
+	EXPECT_EQ(values[1], r->getProblemSpace());
+	EXPECT_EQ(std::string("size=64;threads=4"), r->getProblemSpaceParameters());
+
+	lookup.Parameters.back().second = 8;
+	EXPECT_EQ(nullptr, experiment->getResultByValue(lookup));
+}
@@ -0,0 +1,112 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Benchmark.h>
+#include <celero/Experiment.h>
+#include <celero/ProgressStream.h>
+#include <gtest/gtest.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+
+namespace
+{
+	/// Experiments only keep a weak reference to their benchmark.
+	const auto TestBenchmark = std::make_shared<celero::Benchmark>("Group");
+
+	std::shared_ptr<celero::Experiment> MakeExperiment()
+	{
+		auto experiment = std::make_shared<celero::Experiment>(TestBenchmark);
+		experiment->setName("Experiment");
+		return experiment;
+	}
+
+	std::string ReadAvailable(int fd)
+	{
+		char buffer[4096];
+		const auto size = ::read(fd, buffer, sizeof(buffer));
+		return (size > 0) ? std::string(buffer, static_cast<size_t>(size)) : std::string();
+	}
+} // namespace
+
+TEST(ProgressStream, fileDescriptorReaderCloses)
+{
+	int fds[2];
+	ASSERT_EQ(0, ::pipe(fds));
+
+	const auto experiment = MakeExperiment();
+	auto& stream = celero::ProgressStream::Instance();
+
+	ASSERT_TRUE(stream.open("fd:" + std::to_string(fds[1])));
+	EXPECT_TRUE(stream.isOpen());
+
+	stream.experimentComplete(experiment);
+
+	const auto line = ReadAvailable(fds[0]);
+	EXPECT_EQ(0u, line.find("{\"event\":\"experimentComplete\""));
+	EXPECT_EQ(std::string("\"group\":\"Group\",\"experiment\":\"Experiment\"}\n"), line.substr(line.find("\"group\"")));
+
+	// The reader goes away mid-run.  The next event must close the stream instead of raising SIGPIPE.
+	::close(fds[0]);
+	stream.experimentComplete(experiment);
+	EXPECT_FALSE(stream.isOpen());
+
+	stream.experimentComplete(experiment);
+	EXPECT_FALSE(stream.isOpen());
+
+	stream.close();
+	::close(fds[1]);
+}
+
+TEST(ProgressStream, fifoReaderCloses)
+{
+	const std::string path = "celero-progress-stream-test.fifo";
+	std::remove(path.c_str());
+	ASSERT_EQ(0, ::mkfifo(path.c_str(), 0600));
+
+	// Opening a FIFO for writing waits for a reader, so open the reading end first.
+	const auto reader = ::open(path.c_str(), O_RDONLY | O_NONBLOCK);
+	ASSERT_GE(reader, 0);
+
+	const auto experiment = MakeExperiment();
+	auto& stream = celero::ProgressStream::Instance();
+
+	ASSERT_TRUE(stream.open(path));
+	stream.experimentComplete(experiment);
+	EXPECT_EQ(0u, ReadAvailable(reader).find("{\"event\":\"experimentComplete\""));
+
+	::close(reader);
+	stream.experimentComplete(experiment);
+	EXPECT_FALSE(stream.isOpen());
+
+	stream.close();
+	std::remove(path.c_str());
+}
+
+TEST(ProgressStream, invalidTarget)
+{
+	auto& stream = celero::ProgressStream::Instance();
+	EXPECT_FALSE(stream.open("fd:x"));
+	EXPECT_FALSE(stream.isOpen());
+}
+#endif
@@ -0,0 +1,163 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Benchmark.h>
+#include <celero/Experiment.h>
+#include <celero/ExperimentResult.h>
+#include <celero/Registrar.h>
+#include <celero/TestVector.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+TEST(Registrar, registerInLoop)
+{
+	auto& vector = celero::TestVector::Instance();
+	vector.clear();
+
+	celero::Register("Codec", "Copy").baseline().samples(3).iterations(4).run([](celero::State&) {});
+
+	for(const std::string name : {"Fast", "Slow"})
+	{
+		celero::Register("Codec", name).samples(5).iterations(6).threads(2).target(1.5).run([](celero::State&) {});
+	}
+
+	const auto bm = vector["Codec"];
+	ASSERT_TRUE(bm != nullptr);
+	ASSERT_TRUE(bm->getBaseline() != nullptr);
+	EXPECT_EQ(std::string("Copy"), bm->getBaseline()->getName());
+	EXPECT_EQ(uint64_t{3}, bm->getBaseline()->getSamples());
+	EXPECT_EQ(uint64_t{4}, bm->getBaseline()->getIterations());
+
+	ASSERT_EQ(size_t{2}, bm->getExperimentSize());
+	EXPECT_EQ(std::string("Fast"), bm->getExperiment(0)->getName());
+	EXPECT_EQ(std::string("Slow"), bm->getExperiment(1)->getName());
+	EXPECT_EQ(uint64_t{5}, bm->getExperiment(1)->getSamples());
+	EXPECT_EQ(uint64_t{6}, bm->getExperiment(1)->getIterations());
+	EXPECT_EQ(uint64_t{2}, bm->getExperiment(1)->getThreads());
+
+	EXPECT_TRUE(celero::Register("Codec", "Empty").run(nullptr) == nullptr);
+	EXPECT_EQ(size_t{2}, bm->getExperimentSize());
+
+	vector.clear();
+}
+
+TEST(Registrar, runFixture)
+{
+	auto& vector = celero::TestVector::Instance();
+	vector.clear();
+
+	std::vector<int64_t> blocks;
+	uint64_t setUps = 0;
+	uint64_t tearDowns = 0;
+
+	celero::Register("Runtime", "Blocks")
+		.problemSpace(celero::ProblemSpace().axis("block", {16, 32}))
+		.bytesPerIteration([](const celero::TestFixture::ExperimentValue* x) { return x->getParameter("block"); })
+		.itemsPerIteration(1)
+		.setUp([&setUps](celero::State&) { ++setUps; })
+		.tearDown([&tearDowns](celero::State&) { ++tearDowns; })
+		.run([&blocks](celero::State& state) { blocks.push_back(state.getParameter("block")); });
+
+	const auto factory = vector["Runtime"]->getExperiment(0)->getFactory();
+	ASSERT_TRUE(factory != nullptr);
+	EXPECT_TRUE(factory->getReportsBytes());
+	EXPECT_TRUE(factory->getReportsItems());
+
+	const auto& values = factory->getExperimentValues();
+	ASSERT_EQ(size_t{2}, values.size());
+
+	auto fixture = factory->Create();
+	EXPECT_EQ(int64_t{32}, fixture->getBytesPerIteration(values[1].get()));
+	EXPECT_EQ(int64_t{1}, fixture->getItemsPerIteration(values[1].get()));
+
+	fixture->run(1, 2, values[0].get());
+	fixture->run(1, 1, values[1].get());
+
+	EXPECT_EQ(std::vector<int64_t>({16, 16, 32}), blocks);
+	EXPECT_EQ(uint64_t{2}, setUps);
+	EXPECT_EQ(uint64_t{2}, tearDowns);
+
+	vector.clear();
+}
+
+TEST(Registrar, copyIsIndependent)
+{
+	auto& vector = celero::TestVector::Instance();
+	vector.clear();
+
+	auto registrar = celero::Register("Copies", "Original").samples(7);
+	auto copy = registrar;
+	copy.samples(8);
+
+	registrar.run([](celero::State&) {});
+	copy.run([](celero::State&) {});
+
+	// Changing the registrar after run() does not change the registered benchmark.
+	registrar.samples(9);
+
+	const auto bm = vector["Copies"];
+	ASSERT_EQ(size_t{2}, bm->getExperimentSize());
+	EXPECT_EQ(uint64_t{7}, bm->getExperiment(0)->getSamples());
+	EXPECT_EQ(uint64_t{8}, bm->getExperiment(1)->getSamples());
+
+	vector.clear();
+}
+
+TEST(Registrar, sharedProblemSpaceKeepsIterations)
+{
+	auto& vector = celero::TestVector::Instance();
+	vector.clear();
+
+	// One list of values reused by every benchmark, as when the same block sizes are run for several codecs.
+	const auto blocks = celero::ProblemSpace().axis("block", {16, 32}).build();
+
+	celero::Register("Shared", "Baseline").baseline().samples(1).iterations(7).problemSpace(blocks).run([](celero::State&) {});
+	celero::Register("Shared", "Benchmark").samples(1).iterations(500).problemSpace(blocks).run([](celero::State&) {});
+
+	const auto bm = vector["Shared"];
+	ASSERT_TRUE(bm != nullptr);
+
+	const auto baseline = bm->getBaseline();
+	const auto experiment = bm->getExperiment(0);
+
+	// Add the problem space of each experiment as the executor does.
+	for(const auto& e : {baseline, experiment})
+	{
+		for(const auto& i : e->getFactory()->getExperimentValues())
+		{
+			e->addProblemSpace(i);
+		}
+	}
+
+	ASSERT_EQ(size_t{2}, baseline->getResultSize());
+	ASSERT_EQ(size_t{2}, experiment->getResultSize());
+
+	for(size_t i = 0; i < 2; ++i)
+	{
+		EXPECT_EQ(uint64_t{7}, baseline->getResult(i)->getProblemSpaceIterations());
+		EXPECT_EQ(uint64_t{500}, experiment->getResult(i)->getProblemSpaceIterations());
+	}
+
+	// The shared values are not changed by either experiment.
+	EXPECT_EQ(int64_t{0}, blocks[0]->Iterations);
+	EXPECT_EQ(int64_t{0}, blocks[1]->Iterations);
+
+	vector.clear();
+}
@@ -0,0 +1,67 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Benchmark.h>
+#include <celero/Experiment.h>
+#include <celero/Registration.h>
+#include <celero/TestVector.h>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+	template <typename T>
+	class TypedFixture : public celero::TestFixture
+	{
+	public:
+		T value{};
+	};
+} // namespace
+
+TEST(Registration, TemplateBenchmarkName)
+{
+	const char* const typeList = "(int, std::map<int, int>, std::pair<std::vector<int>, char>)";
+
+	EXPECT_EQ(std::string("Find<int>"), celero::impl::TemplateBenchmarkName("Find", typeList, 0));
+	EXPECT_EQ(std::string("Find<std::map<int, int>>"), celero::impl::TemplateBenchmarkName("Find", typeList, 1));
+	EXPECT_EQ(std::string("Find<std::pair<std::vector<int>, char>>"), celero::impl::TemplateBenchmarkName("Find", typeList, 2));
+	EXPECT_EQ(std::string("Find<double>"), celero::impl::TemplateBenchmarkName("Find", "(double)", 0));
+}
+
+TEST(Registration, TemplateRegistration)
+{
+	auto& vector = celero::TestVector::Instance();
+	vector.clear();
+
+	using Registration = celero::TemplateRegistration<TypedFixture, int, std::map<int, int>, double>;
+	const Registration registration("Typed", "Sweep", "(int, std::map<int, int>, double)", 3, 4, 1);
+
+	const auto bm = vector["Typed"];
+	ASSERT_TRUE(bm != nullptr);
+	ASSERT_EQ(size_t{3}, bm->getExperimentSize());
+	EXPECT_EQ(std::string("Sweep<int>"), bm->getExperiment(0)->getName());
+	EXPECT_EQ(std::string("Sweep<std::map<int, int>>"), bm->getExperiment(1)->getName());
+	EXPECT_EQ(std::string("Sweep<double>"), bm->getExperiment(2)->getName());
+	EXPECT_EQ(uint64_t{3}, bm->getExperiment(2)->getSamples());
+	EXPECT_EQ(uint64_t{4}, bm->getExperiment(2)->getIterations());
+
+	vector.clear();
+}
@@ -0,0 +1,80 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015, 2016, 2017 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/RegressionDetector.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+	std::vector<celero::ArchiveHistoryPoint> MakeHistory(const std::vector<double>& usPerCall)
+	{
+		std::vector<celero::ArchiveHistoryPoint> history;
+
+		for(const auto i : usPerCall)
+		{
+			celero::ArchiveHistoryPoint p;
+			p.UsPerCall = i;
+			history.push_back(p);
+		}
+
+		return history;
+	}
+} // namespace
+
+TEST(RegressionDetector, Instance)
+{
+	EXPECT_NO_THROW(celero::RegressionDetector::Instance());
+	EXPECT_FALSE(celero::RegressionDetector::Instance().getEnabled());
+}
+
+TEST(RegressionDetector, check)
+{
+	auto& x = celero::RegressionDetector::Instance();
+	x.setThreshold(10.0);
+	x.setSigma(3.0);
+	x.setWindow(10);
+
+	// No history, nothing to compare against.
+	EXPECT_DOUBLE_EQ(0.0, x.check(2.0, MakeHistory({})));
+
+	// A single archived run only uses the percentage threshold.
+	EXPECT_DOUBLE_EQ(0.0, x.check(1.05, MakeHistory({1.0})));
+	EXPECT_DOUBLE_EQ(1.0, x.check(1.5, MakeHistory({1.0})));
+
+	// Faster results are never regressions.
+	EXPECT_DOUBLE_EQ(0.0, x.check(0.5, MakeHistory({1.0, 1.0, 1.0})));
+
+	// Noisy history requires the result to clear the sigma band as well.
+	EXPECT_DOUBLE_EQ(0.0, x.check(1.5, MakeHistory({0.5, 1.5, 0.5, 1.5})));
+	EXPECT_DOUBLE_EQ(1.0, x.check(1.5, MakeHistory({0.99, 1.01, 0.99, 1.01})));
+}
+
+TEST(RegressionDetector, checkWindow)
+{
+	auto& x = celero::RegressionDetector::Instance();
+	x.setThreshold(10.0);
+	x.setSigma(0.0);
+	x.setWindow(2);
+
+	// Only the two most recent runs are considered, so an old, faster run is ignored.
+	EXPECT_DOUBLE_EQ(0.0, x.check(2.0, MakeHistory({1.0, 2.0, 2.0})));
+	EXPECT_DOUBLE_EQ(2.0, x.check(3.0, MakeHistory({1.0, 2.0, 2.0})));
+
+	x.setSigma(3.0);
+	x.setWindow(10);
+}
@@ -0,0 +1,115 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015, 2016, 2017 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Benchmark.h>
+#include <celero/Experiment.h>
+#include <celero/ExperimentResult.h>
+#include <celero/ResultTable.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+TEST(ResultTable, Instance)
+{
+	EXPECT_NO_THROW(celero::ResultTable::Instance());
+}
+
+TEST(ResultTable, stableSchema)
+{
+	const std::string fileName{"ResultTable.stableSchema.csv"};
+
+	auto benchmark = std::make_shared<celero::Benchmark>("Group");
+	auto experiment = std::make_shared<celero::Experiment>(benchmark, "Experiment", 1, 10, 1, 0.0);
+	experiment->setIsBaselineCase(true);
+	benchmark->addExperiment(experiment);
+
+	auto result = std::make_shared<celero::ExperimentResult>(experiment.get());
+	result->setProblemSpaceValue(std::make_shared<celero::TestFixture::ExperimentValue>(64, 10));
+	result->addRunTimeSample(100);
+
+	auto& x = celero::ResultTable::Instance();
+	x.setFileName(fileName);
+	x.setUserDefinedFields({"Zeta Mean", "Alpha Mean"});
+	x.add(result);
+	x.add(result);
+	x.closeFile();
+
+	std::ifstream is(fileName);
+	std::string header;
+	std::string row;
+	ASSERT_TRUE(std::getline(is, header).good());
+	ASSERT_TRUE(std::getline(is, row).good());
+
+	// User-defined columns are sorted, and rows without them still have a cell for each.
+	const auto alpha = header.find("Alpha Mean,");
+	EXPECT_NE(std::string::npos, alpha);
+	EXPECT_LT(alpha, header.find("Zeta Mean,"));
+	EXPECT_EQ(std::count(std::begin(header), std::end(header), ','), std::count(std::begin(row), std::end(row), ','));
+	EXPECT_EQ(std::string(",,"), row.substr(row.size() - 2));
+	EXPECT_EQ(0, row.find("Group,Experiment,64,1,10,0,1,10,"));
+
+	is.close();
+	std::remove(fileName.c_str());
+}
+
+TEST(ResultTable, problemSpaceAxes)
+{
+	const std::string fileName{"ResultTable.problemSpaceAxes.csv"};
+
+	auto benchmark = std::make_shared<celero::Benchmark>("Group");
+	auto experiment = std::make_shared<celero::Experiment>(benchmark, "Experiment", 1, 10, 1, 0.0);
+	experiment->setIsBaselineCase(true);
+	benchmark->addExperiment(experiment);
+
+	auto ps = std::make_shared<celero::TestFixture::ExperimentValue>(64, 10);
+	ps->Parameters = {{"size", 64}, {"threads", 4}};
+
+	auto result = std::make_shared<celero::ExperimentResult>(experiment.get());
+	result->setProblemSpaceValue(ps);
+	result->addRunTimeSample(100);
+
+	auto plain = std::make_shared<celero::ExperimentResult>(experiment.get());
+	plain->setProblemSpaceValue(std::make_shared<celero::TestFixture::ExperimentValue>(32, 10));
+	plain->addRunTimeSample(100);
+
+	auto& x = celero::ResultTable::Instance();
+	x.setFileName(fileName);
+	x.add(result);
+	x.add(plain);
+	x.closeFile();
+
+	std::ifstream is(fileName);
+	std::string header;
+	std::string row;
+	std::string plainRow;
+	ASSERT_TRUE(std::getline(is, header).good());
+	ASSERT_TRUE(std::getline(is, row).good());
+	ASSERT_TRUE(std::getline(is, plainRow).good());
+
+	// Each axis gets its own column after the problem space; rows without parameters leave them empty.
+	EXPECT_EQ(0, header.find("Group,Experiment,Problem Space,size,threads,Samples,"));
+	EXPECT_EQ(0, row.find("Group,Experiment,64,64,4,1,10,"));
+	EXPECT_EQ(0, plainRow.find("Group,Experiment,32,,,1,10,"));
+	EXPECT_EQ(std::count(std::begin(header), std::end(header), ','), std::count(std::begin(row), std::end(row), ','));
+
+	is.close();
+	std::remove(fileName.c_str());
+}
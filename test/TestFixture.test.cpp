@@ -18,6 +18,9 @@
 #include <celero/TestFixture.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
+
 namespace
 {
 	class Fixture : public celero::TestFixture
@@ -48,6 +51,34 @@ namespace
 		bool onSetUp{false};
 		bool onTearDown{false};
 	};
+
+	class PausingFixture : public celero::TestFixture
+	{
+	public:
+		bool leavePaused{false};
+
+	protected:
+		void UserBenchmark() override
+		{
+			this->pauseTiming();
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+			if(this->leavePaused == false)
+			{
+				this->resumeTiming();
+			}
+		}
+	};
+
+	class ManualFixture : public celero::TestFixture
+	{
+	protected:
+		void UserBenchmark() override
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			this->setIterationTime(2500);
+		}
+	};
 } // namespace
 
 TEST(TestFixture, Run)
@@ -63,3 +94,25 @@ TEST(TestFixture, Run)
 
 	EXPECT_EQ(iterations, fixture.getExperimentIterations());
 }
+
+TEST(TestFixture, PauseTiming)
+{
+	PausingFixture fixture;
+
+	// Five 2ms sleeps are excluded from the sample time.
+	const auto time = fixture.run(1, 5, nullptr);
+	EXPECT_LT(time, uint64_t(5000));
+	EXPECT_EQ(time, fixture.getExperimentTime());
+
+	// A pause left open ends with the sample.
+	fixture.leavePaused = true;
+	EXPECT_LT(fixture.run(1, 5, nullptr), uint64_t(5000));
+}
+
+TEST(TestFixture, SetIterationTime)
+{
+	ManualFixture fixture;
+
+	// The reported 2.5us per iteration replaces the measured time.
+	EXPECT_EQ(uint64_t(10), fixture.run(1, 4, nullptr));
+}
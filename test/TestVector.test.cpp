@@ -15,6 +15,8 @@
 /// See the License for the specific language governing permissions and
 /// limitations under the License.
 ///
+#include <celero/Experiment.h>
+#include <celero/Registration.h>
 #include <celero/TestVector.h>
 #include <gtest/gtest.h>
 
@@ -67,3 +69,32 @@ TEST(TestVector, operator_name)
 
 	EXPECT_EQ(vector.size(), size_t{3});
 }
+
+TEST(TestVector, pendingRegistrations)
+{
+	auto& vector = celero::TestVector::Instance();
+	EXPECT_NO_THROW(vector.clear());
+
+	// Registrations only link themselves into a list.  Benchmarks are created, in declaration order, when the vector is next used.
+	const auto factory = &celero::CreateGenericFactory<celero::TestFixture>;
+	const celero::Registration baseline(celero::Registration::Kind::Baseline, "Pending", "Base", 1, 2, 1, factory);
+	const celero::Registration first(celero::Registration::Kind::Test, "Pending", "First", 3, 4, 1, factory);
+	const celero::Registration second(celero::Registration::Kind::Test, "Pending", "Second", 5, 6, 1, factory, 2.0);
+
+	EXPECT_TRUE(vector.containsGroup("Pending"));
+	EXPECT_EQ(vector.size(), size_t{1});
+
+	const auto bm = vector["Pending"];
+	ASSERT_TRUE(bm != nullptr);
+	ASSERT_TRUE(bm->getBaseline() != nullptr);
+	EXPECT_EQ(std::string("Base"), bm->getBaseline()->getName());
+
+	ASSERT_EQ(size_t{2}, bm->getExperimentSize());
+	EXPECT_EQ(std::string("First"), bm->getExperiment(0)->getName());
+	EXPECT_EQ(uint64_t{3}, bm->getExperiment(0)->getSamples());
+	EXPECT_EQ(std::string("Second"), bm->getExperiment(1)->getName());
+	EXPECT_DOUBLE_EQ(2.0, bm->getExperiment(1)->getBaselineTarget());
+
+	EXPECT_NO_THROW(vector.clear());
+	EXPECT_FALSE(vector.containsGroup("Pending"));
+}
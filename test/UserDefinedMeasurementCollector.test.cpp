@@ -17,8 +17,13 @@
 ///
 
 #include <celero/UserDefinedMeasurementCollector.h>
+#include <celero/UserDefinedMeasurementCounter.h>
+#include <celero/UserDefinedMeasurementTemplate.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <map>
+
 TEST(UserDefinedMeasurementCollector, getFields)
 {
 	auto fixture = std::make_shared<celero::TestFixture>();
@@ -39,4 +44,151 @@ TEST(UserDefinedMeasurementCollector, getAggregateValues)
 
 	const auto values = collector.getAggregateValues();
 	EXPECT_TRUE(values.empty());
-}
\ No newline at end of file
+}
+
+TEST(UserDefinedMeasurementCollector, freeze)
+{
+	class Fixture : public celero::TestFixture
+	{
+	public:
+		class Count : public celero::UserDefinedMeasurementTemplate<int>
+		{
+		public:
+			std::string getName() const override
+			{
+				return "count";
+			}
+		};
+
+		std::vector<std::shared_ptr<celero::UserDefinedMeasurement>> getUserDefinedMeasurements() const override
+		{
+			return {this->count};
+		}
+
+		std::shared_ptr<Count> count{std::make_shared<Count>()};
+	};
+
+	auto fixture = std::make_shared<Fixture>();
+	fixture->count->addValue(4);
+	fixture->count->addValue(6);
+
+	celero::UserDefinedMeasurementCollector collector(std::vector<std::string>{"count"});
+	collector.collect(fixture);
+	collector.freeze();
+
+	// Resetting the measurement, as is done for a reused fixture, keeps the frozen values.
+	fixture->count->reset();
+
+	auto mean = 0.0;
+
+	for(const auto& i : collector.getAggregateValues())
+	{
+		if(i.first == "count Mean")
+		{
+			mean = i.second;
+		}
+	}
+
+	EXPECT_DOUBLE_EQ(5.0, mean);
+}
+
+TEST(UserDefinedMeasurementCollector, collectMergesBySlot)
+{
+	class Count : public celero::UserDefinedMeasurementTemplate<int>
+	{
+	public:
+		explicit Count(std::string x) : name(std::move(x))
+		{
+		}
+
+		std::string getName() const override
+		{
+			return this->name;
+		}
+
+	private:
+		std::string name;
+	};
+
+	// The names are announced in a different order than the fixture returns its measurements.
+	celero::UserDefinedMeasurementCollector collector(std::vector<std::string>{"b", "a"});
+
+	for(int i = 0; i < 3; ++i)
+	{
+		auto a = std::make_shared<Count>("a");
+		auto b = std::make_shared<Count>("b");
+		auto c = std::make_shared<Count>("c");
+		a->addValue(1);
+		b->addValue(10);
+		c->addValue(100);
+
+		collector.collect(std::vector<std::shared_ptr<celero::UserDefinedMeasurement>>{a, b, c});
+	}
+
+	collector.freeze();
+
+	const auto& values = collector.getAggregateValues();
+	EXPECT_TRUE(std::is_sorted(std::begin(values), std::end(values)));
+
+	std::map<std::string, double> byName(std::begin(values), std::end(values));
+	EXPECT_DOUBLE_EQ(3.0, byName["a # Samp"]);
+	EXPECT_DOUBLE_EQ(1.0, byName["a Mean"]);
+	EXPECT_DOUBLE_EQ(3.0, byName["b # Samp"]);
+	EXPECT_DOUBLE_EQ(10.0, byName["b Mean"]);
+
+	// A measurement which was not announced still gets a slot.
+	EXPECT_DOUBLE_EQ(100.0, byName["c Mean"]);
+
+	// Frozen values are the same instance every time.
+	EXPECT_EQ(&values, &collector.getAggregateValues());
+}
+
+TEST(UserDefinedMeasurementCollector, collectFollowsReorderedMeasurements)
+{
+	class Count : public celero::UserDefinedMeasurementTemplate<int>
+	{
+	public:
+		std::string getName() const override
+		{
+			return "count";
+		}
+	};
+
+	class Hits : public celero::UserDefinedMeasurementCounter
+	{
+	public:
+		std::string getName() const override
+		{
+			return "hits";
+		}
+	};
+
+	celero::UserDefinedMeasurementCollector collector(std::vector<std::string>{"count", "hits"});
+
+	for(int i = 0; i < 2; ++i)
+	{
+		auto count = std::make_shared<Count>();
+		auto hits = std::make_shared<Hits>();
+		count->addValue(5);
+		hits->addValue(7.0);
+
+		// The same number of measurements, but in a different order on the second sample.  Each must still merge into its own slot,
+		// since a slot only merges measurements of its own type.
+		if(i == 0)
+		{
+			collector.collect(std::vector<std::shared_ptr<celero::UserDefinedMeasurement>>{count, hits});
+		}
+		else
+		{
+			collector.collect(std::vector<std::shared_ptr<celero::UserDefinedMeasurement>>{hits, count});
+		}
+	}
+
+	collector.freeze();
+
+	const auto& values = collector.getAggregateValues();
+	std::map<std::string, double> byName(std::begin(values), std::end(values));
+	EXPECT_DOUBLE_EQ(2.0, byName["count # Samp"]);
+	EXPECT_DOUBLE_EQ(5.0, byName["count Mean"]);
+	EXPECT_DOUBLE_EQ(14.0, byName["hits Sum"]);
+}
@@ -0,0 +1,81 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/UserDefinedMeasurementCounter.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace
+{
+	class HitsUDM : public celero::UserDefinedMeasurementCounter
+	{
+	public:
+		std::string getName() const override
+		{
+			return "Hits";
+		}
+	};
+} // namespace
+
+TEST(UserDefinedMeasurementCounter, ratePerSecondOfSampleTime)
+{
+	HitsUDM udm;
+	EXPECT_DOUBLE_EQ(0.0, udm.getPerSecond());
+
+	udm.addValue(400.0);
+	udm.increment();
+	udm.onSample(500000, 10);
+
+	EXPECT_DOUBLE_EQ(401.0, udm.getSum());
+	EXPECT_DOUBLE_EQ(802.0, udm.getPerSecond());
+	EXPECT_DOUBLE_EQ(40.1, udm.getPerIteration());
+}
+
+TEST(UserDefinedMeasurementCounter, mergeAddsTime)
+{
+	HitsUDM a;
+	a.addValue(100.0);
+	a.onSample(1000000, 1);
+
+	HitsUDM b;
+	b.addValue(300.0);
+	b.onSample(1000000, 1);
+
+	a.merge(&b);
+	EXPECT_DOUBLE_EQ(400.0, a.getSum());
+	EXPECT_DOUBLE_EQ(200.0, a.getPerSecond());
+
+	a.reset();
+	EXPECT_DOUBLE_EQ(0.0, a.getSum());
+	EXPECT_DOUBLE_EQ(0.0, a.getPerSecond());
+}
+
+TEST(UserDefinedMeasurementCounter, untimedSampleOnlyAddsToSum)
+{
+	HitsUDM udm;
+	udm.addValue(100.0);
+	udm.onSample(1000000, 10);
+
+	udm.addValue(500.0);
+	udm.onSample(0, 10);
+
+	EXPECT_DOUBLE_EQ(600.0, udm.getSum());
+	EXPECT_DOUBLE_EQ(100.0, udm.getPerSecond());
+	EXPECT_DOUBLE_EQ(10.0, udm.getPerIteration());
+}
@@ -0,0 +1,121 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/UserDefinedMeasurementHistogram.h>
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+
+namespace
+{
+	class LatencyUDM : public celero::UserDefinedMeasurementHistogram
+	{
+	public:
+		std::string getName() const override
+		{
+			return "Latency";
+		}
+	};
+} // namespace
+
+TEST(UserDefinedMeasurementHistogram, empty)
+{
+	LatencyUDM udm;
+	EXPECT_EQ(uint64_t(0), udm.getSize());
+	EXPECT_DOUBLE_EQ(0.0, udm.getPercentile(50.0));
+	EXPECT_DOUBLE_EQ(0.0, udm.getMean());
+}
+
+TEST(UserDefinedMeasurementHistogram, smallValuesAreExact)
+{
+	LatencyUDM udm;
+
+	for(uint64_t i = 1; i <= 20; ++i)
+	{
+		udm.addValue(i);
+	}
+
+	EXPECT_EQ(uint64_t(20), udm.getSize());
+	EXPECT_DOUBLE_EQ(10.5, udm.getMean());
+	EXPECT_DOUBLE_EQ(10.0, udm.getPercentile(50.0));
+	EXPECT_DOUBLE_EQ(20.0, udm.getPercentile(99.0));
+	EXPECT_DOUBLE_EQ(1.0, udm.getPercentile(0.0));
+}
+
+TEST(UserDefinedMeasurementHistogram, tailPercentiles)
+{
+	LatencyUDM udm;
+
+	// 990 fast values and 10 slow ones.
+	for(int i = 0; i < 990; ++i)
+	{
+		udm.addValue(1000);
+	}
+
+	for(int i = 0; i < 10; ++i)
+	{
+		udm.addValue(1000000);
+	}
+
+	EXPECT_NEAR(1000.0, udm.getPercentile(50.0), 1000.0 * 0.016);
+	EXPECT_NEAR(1000.0, udm.getPercentile(99.0), 1000.0 * 0.016);
+	EXPECT_NEAR(1000000.0, udm.getPercentile(99.9), 1000000.0 * 0.016);
+}
+
+TEST(UserDefinedMeasurementHistogram, largeValues)
+{
+	LatencyUDM udm;
+	udm.addValue(std::numeric_limits<uint64_t>::max());
+	udm.addValue(uint64_t(1) << 40);
+
+	EXPECT_NEAR(static_cast<double>(uint64_t(1) << 40), udm.getPercentile(50.0), static_cast<double>(uint64_t(1) << 40) * 0.016);
+	EXPECT_NEAR(static_cast<double>(std::numeric_limits<uint64_t>::max()), udm.getPercentile(100.0), 1.8e19 * 0.016);
+}
+
+TEST(UserDefinedMeasurementHistogram, mergeAndReset)
+{
+	LatencyUDM a;
+	LatencyUDM b;
+	a.addValue(5);
+	b.addValue(7);
+	b.addValue(9);
+
+	a.merge(&b);
+	EXPECT_EQ(uint64_t(3), a.getSize());
+	EXPECT_DOUBLE_EQ(7.0, a.getPercentile(50.0));
+
+	a.reset();
+	EXPECT_EQ(uint64_t(0), a.getSize());
+}
+
+TEST(UserDefinedMeasurementHistogram, aggregationNames)
+{
+	LatencyUDM udm;
+	udm.addValue(3);
+
+	std::vector<std::string> names;
+
+	for(const auto& aggregate : udm.getAggregationInfo())
+	{
+		names.push_back(aggregate.first);
+	}
+
+	const std::vector<std::string> expected{"# Samp", "Mean", "Min", "p50", "p99", "p999", "Max"};
+	EXPECT_EQ(expected, names);
+}
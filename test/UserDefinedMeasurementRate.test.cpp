@@ -0,0 +1,113 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/UserDefinedMeasurementRate.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+
+namespace
+{
+	class MessagesUDM : public celero::UserDefinedMeasurementRate
+	{
+	public:
+		std::string getName() const override
+		{
+			return "Messages";
+		}
+	};
+} // namespace
+
+TEST(UserDefinedMeasurementRate, empty)
+{
+	MessagesUDM udm;
+	EXPECT_DOUBLE_EQ(0.0, udm.getPerSecond());
+	EXPECT_DOUBLE_EQ(0.0, udm.getPerIteration());
+	EXPECT_DOUBLE_EQ(0.0, udm.getStandardDeviation());
+}
+
+TEST(UserDefinedMeasurementRate, weightedBySampleTime)
+{
+	MessagesUDM udm;
+
+	// 100 events in 1 second, then 900 events in 3 seconds.
+	udm.addValue(100.0);
+	udm.onSample(1000000, 10);
+	udm.addValue(450.0);
+	udm.addValue(450.0);
+	udm.onSample(3000000, 30);
+
+	// 1000 events in 4 seconds, not the mean of 100/s and 300/s.
+	EXPECT_DOUBLE_EQ(250.0, udm.getPerSecond());
+	EXPECT_DOUBLE_EQ(25.0, udm.getPerIteration());
+
+	// Rates of 100 (weight 1) and 300 (weight 3) around 250.
+	EXPECT_NEAR(std::sqrt((1.0 * 150.0 * 150.0 + 3.0 * 50.0 * 50.0) / 4.0), udm.getStandardDeviation(), 1.0e-9);
+
+	double min = 0.0;
+	double max = 0.0;
+
+	for(const auto& aggregate : udm.getAggregationInfo())
+	{
+		if(aggregate.first == "Min")
+		{
+			min = aggregate.second();
+		}
+		else if(aggregate.first == "Max")
+		{
+			max = aggregate.second();
+		}
+	}
+
+	EXPECT_DOUBLE_EQ(100.0, min);
+	EXPECT_DOUBLE_EQ(300.0, max);
+}
+
+TEST(UserDefinedMeasurementRate, mergeAndReset)
+{
+	MessagesUDM a;
+	a.addValue(10.0);
+	a.onSample(1000000, 1);
+
+	MessagesUDM b;
+	b.addValue(30.0);
+	b.onSample(1000000, 1);
+
+	a.merge(&b);
+	EXPECT_DOUBLE_EQ(20.0, a.getPerSecond());
+	EXPECT_DOUBLE_EQ(10.0, a.getStandardDeviation());
+
+	a.reset();
+	EXPECT_DOUBLE_EQ(0.0, a.getPerSecond());
+}
+
+TEST(UserDefinedMeasurementRate, untimedSampleIgnored)
+{
+	MessagesUDM udm;
+	udm.addValue(100.0);
+	udm.onSample(1000000, 10);
+
+	// A sample too short to be timed must not add events without adding time.
+	udm.addValue(500.0);
+	udm.onSample(0, 10);
+
+	EXPECT_DOUBLE_EQ(100.0, udm.getPerSecond());
+	EXPECT_DOUBLE_EQ(10.0, udm.getPerIteration());
+	EXPECT_DOUBLE_EQ(0.0, udm.getStandardDeviation());
+}
@@ -0,0 +1,60 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/UserDefinedMeasurementRatio.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace
+{
+	class HitRateUDM : public celero::UserDefinedMeasurementRatio
+	{
+	public:
+		std::string getName() const override
+		{
+			return "Hit Rate";
+		}
+	};
+} // namespace
+
+TEST(UserDefinedMeasurementRatio, hitsOverLookups)
+{
+	HitRateUDM udm;
+	EXPECT_DOUBLE_EQ(0.0, udm.getRatio());
+
+	udm.addValue(true);
+	udm.addValue(true);
+	udm.addValue(true);
+	udm.addValue(false);
+
+	EXPECT_DOUBLE_EQ(0.75, udm.getRatio());
+}
+
+TEST(UserDefinedMeasurementRatio, mergeWeighsTotals)
+{
+	HitRateUDM a;
+	a.addValue(1.0, 1.0);
+
+	HitRateUDM b;
+	b.addValue(0.0, 3.0);
+
+	// The merged ratio is 1 of 4, not the mean of the two ratios.
+	a.merge(&b);
+	EXPECT_DOUBLE_EQ(0.25, a.getRatio());
+}
@@ -0,0 +1,121 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015-2023 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/ThreadTestFixture.h>
+#include <celero/UserDefinedMeasurementTemplate.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace
+{
+	class CountUDM : public celero::UserDefinedMeasurementTemplate<int64_t>
+	{
+	public:
+		std::string getName() const override
+		{
+			return "count";
+		}
+
+		double getSize() const
+		{
+			return static_cast<double>(this->getStatistics().getSize());
+		}
+
+		double getMean() const
+		{
+			return this->getStatistics().getMean();
+		}
+	};
+
+	class CountingThreadFixture : public celero::ThreadTestFixture
+	{
+	public:
+		std::vector<std::shared_ptr<celero::UserDefinedMeasurement>> getUserDefinedMeasurements() const override
+		{
+			return {this->udm};
+		}
+
+		void UserBenchmark() override
+		{
+			this->udm->addValue(static_cast<int64_t>(celero::UserDefinedMeasurement::GetThreadShard()));
+		}
+
+		std::shared_ptr<CountUDM> udm{std::make_shared<CountUDM>()};
+	};
+} // namespace
+
+TEST(UserDefinedMeasurementTemplate, addValueWithoutThreads)
+{
+	CountUDM udm;
+	udm.addValue(2);
+	udm.addValue(4);
+
+	EXPECT_DOUBLE_EQ(2.0, udm.getSize());
+	EXPECT_DOUBLE_EQ(3.0, udm.getMean());
+}
+
+TEST(UserDefinedMeasurementTemplate, shardsAreFoldedAtEndThreads)
+{
+	CountUDM udm;
+	udm.addValue(0);
+	udm.beginThreads(2);
+
+	std::thread first([&udm]() {
+		celero::UserDefinedMeasurement::SetThreadShard(1);
+		udm.addValue(10);
+	});
+
+	std::thread second([&udm]() {
+		celero::UserDefinedMeasurement::SetThreadShard(2);
+		udm.addValue(20);
+		udm.addValue(20);
+	});
+
+	first.join();
+	second.join();
+
+	// Only the value added outside the workers is visible until the shards are folded.
+	EXPECT_DOUBLE_EQ(1.0, udm.getSize());
+
+	udm.endThreads();
+	EXPECT_DOUBLE_EQ(4.0, udm.getSize());
+	EXPECT_DOUBLE_EQ(12.5, udm.getMean());
+
+	// Once the shards are gone, a stale worker index falls back to the shared statistics.
+	std::thread stale([&udm]() {
+		celero::UserDefinedMeasurement::SetThreadShard(2);
+		udm.addValue(0);
+	});
+
+	stale.join();
+	EXPECT_DOUBLE_EQ(5.0, udm.getSize());
+}
+
+TEST(UserDefinedMeasurementTemplate, threadTestFixture)
+{
+	CountingThreadFixture fixture;
+	const auto ev = celero::TestFixture::ExperimentValue(0, 1000);
+
+	fixture.run(4, 1000, &ev);
+
+	// Every worker's values are present: 250 from each of workers 1 through 4.
+	EXPECT_DOUBLE_EQ(1000.0, fixture.udm->getSize());
+	EXPECT_DOUBLE_EQ(2.5, fixture.udm->getMean());
+	EXPECT_EQ(size_t(0), celero::UserDefinedMeasurement::GetThreadShard());
+}
@@ -19,7 +19,41 @@
 #include <celero/Utilities.h>
 #include <gtest/gtest.h>
 
+#include <functional>
+#include <vector>
+
 TEST(Utilities, UsPerSec)
 {
 	EXPECT_EQ(static_cast<decltype(celero::UsPerSec)>(1000000), celero::UsPerSec);
 }
+
+TEST(Utilities, DoNotOptimizeAway)
+{
+	int x = 42;
+	celero::DoNotOptimizeAway(x);
+	EXPECT_EQ(42, x);
+
+	celero::DoNotOptimizeAway(x += 1);
+	EXPECT_EQ(43, x);
+
+	std::vector<int> v(16, 7);
+	celero::DoNotOptimizeAway(v);
+	celero::DoNotOptimizeAway(v.data());
+	EXPECT_EQ(size_t(16), v.size());
+
+	bool called = false;
+	celero::DoNotOptimizeAway(std::function<void(void)>([&called]() { called = true; }));
+	EXPECT_TRUE(called);
+
+	EXPECT_NO_THROW(celero::DoNotOptimizeAway(std::function<int(void)>([]() { return 1; })));
+}
+
+TEST(Utilities, ClobberMemory)
+{
+	std::vector<int> v;
+	v.reserve(1);
+	celero::DoNotOptimizeAway(v.data());
+	v.push_back(42);
+	celero::ClobberMemory();
+	EXPECT_EQ(42, v[0]);
+}
@@ -0,0 +1,119 @@
+///
+/// \author	John Farrier
+///
+/// \copyright Copyright 2015, 2016, 2017 John Farrier
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+/// http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+
+#include <celero/Warmup.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+	///
+	/// Restores the default policy of a single warm-up sample, however a test exits.
+	///
+	struct WarmupReset
+	{
+		~WarmupReset()
+		{
+			celero::Warmup::Instance().setCount(1);
+		}
+	};
+} // namespace
+
+TEST(Warmup, Count)
+{
+	WarmupReset reset;
+	auto& warmup = celero::Warmup::Instance();
+
+	warmup.setCount(2);
+	EXPECT_EQ(celero::Warmup::Mode::Count, warmup.getMode());
+	EXPECT_FALSE(warmup.isComplete({}, 0));
+	EXPECT_FALSE(warmup.isComplete({10}, 0));
+	EXPECT_TRUE(warmup.isComplete({10, 10}, 0));
+
+	warmup.setCount(0);
+	EXPECT_TRUE(warmup.isComplete({}, 0));
+}
+
+TEST(Warmup, Duration)
+{
+	WarmupReset reset;
+	auto& warmup = celero::Warmup::Instance();
+
+	warmup.setDuration(1000);
+	EXPECT_EQ(celero::Warmup::Mode::Duration, warmup.getMode());
+
+	// At least one sample is always taken.
+	EXPECT_FALSE(warmup.isComplete({}, 5000));
+	EXPECT_FALSE(warmup.isComplete({10}, 999));
+	EXPECT_TRUE(warmup.isComplete({10}, 1000));
+}
+
+TEST(Warmup, Stable)
+{
+	WarmupReset reset;
+	auto& warmup = celero::Warmup::Instance();
+
+	warmup.setStable(5.0, 3, 10);
+	EXPECT_EQ(celero::Warmup::Mode::Stable, warmup.getMode());
+
+	EXPECT_FALSE(warmup.isComplete({100, 100}, 0));
+	EXPECT_FALSE(warmup.isComplete({500, 100, 102}, 0));
+	EXPECT_TRUE(warmup.isComplete({500, 100, 102, 104}, 0));
+	EXPECT_FALSE(warmup.isComplete({500, 100, 102, 120}, 0));
+
+	// Gives up after the maximum number of samples.
+	EXPECT_TRUE(warmup.isComplete({1, 100, 1, 100, 1, 100, 1, 100, 1, 100}, 0));
+}
+
+TEST(Warmup, setPolicy)
+{
+	WarmupReset reset;
+	auto& warmup = celero::Warmup::Instance();
+
+	EXPECT_TRUE(warmup.setPolicy("5"));
+	EXPECT_EQ(celero::Warmup::Mode::Count, warmup.getMode());
+	EXPECT_FALSE(warmup.isComplete({1, 1, 1, 1}, 0));
+	EXPECT_TRUE(warmup.isComplete({1, 1, 1, 1, 1}, 0));
+
+	EXPECT_TRUE(warmup.setPolicy("200ms"));
+	EXPECT_EQ(celero::Warmup::Mode::Duration, warmup.getMode());
+	EXPECT_FALSE(warmup.isComplete({1}, 199999));
+	EXPECT_TRUE(warmup.isComplete({1}, 200000));
+
+	EXPECT_TRUE(warmup.setPolicy("2s"));
+	EXPECT_TRUE(warmup.isComplete({1}, 2000000));
+
+	EXPECT_TRUE(warmup.setPolicy("stable:2.5"));
+	EXPECT_EQ(celero::Warmup::Mode::Stable, warmup.getMode());
+
+	EXPECT_TRUE(warmup.setPolicy("stable:2:4"));
+	EXPECT_TRUE(warmup.isComplete({1, 100, 1, 100}, 0));
+
+	EXPECT_FALSE(warmup.setPolicy(""));
+	EXPECT_FALSE(warmup.setPolicy("fast"));
+	EXPECT_FALSE(warmup.setPolicy("10min"));
+	EXPECT_FALSE(warmup.setPolicy("stable:"));
+	EXPECT_FALSE(warmup.setPolicy("stable:2:0"));
+	EXPECT_FALSE(warmup.setPolicy("stable:2x"));
+	EXPECT_FALSE(warmup.setPolicy("-1"));
+	EXPECT_FALSE(warmup.setPolicy("-5ms"));
+	EXPECT_FALSE(warmup.setPolicy(" 5"));
+	EXPECT_FALSE(warmup.setPolicy("stable:2:-1"));
+
+	// A rejected policy leaves the previous one in place.
+	EXPECT_EQ(celero::Warmup::Mode::Stable, warmup.getMode());
+}